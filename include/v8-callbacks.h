@@ -454,6 +454,54 @@ using HostCreateShadowRealmContextCallback =
 using IsJSApiWrapperNativeErrorCallback = bool (*)(Isolate* isolate,
                                                    Local<Object> obj);
 
+/**
+ * The optimizing tier that the tiering heuristics picked for a function, see
+ * TieringPolicyCallback.
+ */
+enum class OptimizationTier { kMaglev, kTurbofan };
+
+/**
+ * Profiling signals of a function that V8 is about to optimize.
+ */
+struct TieringCandidate {
+  /** The tier that V8 wants to optimize the function to. */
+  OptimizationTier tier;
+  /** Size of the function's bytecode in bytes. */
+  int bytecode_size;
+  /** Number of invocations recorded in the function's feedback. */
+  int invocation_count;
+  /**
+   * Non-zero if the function is stuck in a long-running loop in a lower tier;
+   * grows with every interrupt taken by that loop.
+   */
+  int osr_urgency;
+  /** Whether optimized code for this function was deoptimized before. */
+  bool was_deoptimized;
+  /** Number of optimization jobs waiting for a compile thread. */
+  size_t compile_queue_length;
+  /** Number of worker threads available to compile jobs. */
+  int worker_thread_count;
+};
+
+enum class TieringDecision {
+  /** Use V8's built-in heuristics. */
+  kDefault,
+  /** Optimize the function now. */
+  kOptimize,
+  /** Don't optimize yet; V8 asks again after the next interrupt budget. */
+  kDelay,
+};
+
+/**
+ * TieringPolicyCallback is called when V8's heuristics decide to optimize a
+ * function, and lets the embedder adjust the tier-up curve, e.g. to tier up
+ * early in batch jobs and late in interactive, latency sensitive contexts.
+ * The callback is called with garbage collection disallowed and must not
+ * call back into V8.
+ */
+using TieringPolicyCallback =
+    TieringDecision (*)(Isolate* isolate, const TieringCandidate& candidate);
+
 /**
  * PrepareStackTraceCallback is called when the stack property of an error is
  * first accessed. The return value will be used as the stack value. If this
@@ -818,6 +818,12 @@ class V8_EXPORT Isolate {
   void SetIsJSApiWrapperNativeErrorCallback(
       IsJSApiWrapperNativeErrorCallback callback);
 
+  /**
+   * Set the callback that is consulted before a function is marked for
+   * optimization. Pass nullptr to restore V8's built-in tiering policy.
+   */
+  void SetTieringPolicyCallback(TieringPolicyCallback callback);
+
   /**
    * This specifies the callback called when the stack property of Error
    * is accessed.
@@ -6,11 +6,14 @@
 #define INCLUDE_V8_JSON_H_
 
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
+#include "v8-maybe.h"         // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
 namespace v8 {
 
 class Context;
+class Object;
+class OutputStream;
 class Value;
 class String;
 
@@ -30,6 +33,26 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(
       Local<Context> context, Local<String> json_string);
 
+  /**
+   * Like Parse, but takes |shape_hint| as an example of the objects that
+   * |json_string| contains, e.g. an object previously returned by Parse for a
+   * similar input. Objects in the input that start with the same property key
+   * as an object in |shape_hint| are built directly with its layout if their
+   * properties match, and parsed as usual otherwise. Arrays in |shape_hint|
+   * describe their elements by their first element.
+   *
+   * Only plain objects with data properties are used as hints, other objects
+   * in |shape_hint| are ignored.
+   *
+   * \param the context in which to parse and create the value.
+   * \param json_string The string to parse.
+   * \param shape_hint An example of the objects in |json_string|.
+   * \return The corresponding value if successfully parsed.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<Value> ParseWithShapeHint(
+      Local<Context> context, Local<String> json_string,
+      Local<Object> shape_hint);
+
   /**
    * Tries to stringify the JSON-serializable object |json_object| and returns
    * it as string if successful.
@@ -40,6 +63,29 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Stringifies the JSON-serializable object |json_object| like Stringify,
+   * but writes the result as UTF-8 to |stream| while it is produced instead
+   * of creating a string. This avoids holding the complete result in memory.
+   *
+   * The UTF-8 encoded output is passed to OutputStream::WriteAsciiChunk,
+   * despite its name, in chunks of the stream's preferred size. A chunk may
+   * end in the middle of a multi-byte sequence, which then continues in the
+   * next chunk, so chunks must be concatenated before they are decoded.
+   * OutputStream::EndOfStream is called once all output has been written.
+   * Nothing is written if |json_object| has no JSON representation, e.g. if
+   * it is undefined. The stream must not call into V8.
+   *
+   * \param json_object The JSON-serializable object to stringify.
+   * \param stream The stream to write the output to.
+   * \return Nothing if an exception was thrown, in which case the output
+   *   written so far is incomplete and EndOfStream is not called. Otherwise
+   *   true, or false if the stream aborted the write.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<bool> StringifyToStream(
+      Local<Context> context, Local<Value> json_object, OutputStream* stream,
+      Local<String> gap = Local<String>());
 };
 
 }  // namespace v8
@@ -111,6 +111,17 @@ struct GarbageCollectionYoungCycle {
 #endif  // defined(CPPGC_YOUNG_GENERATION)
 };
 
+/**
+ * Reported when optimized code keeps deoptimizing for the same reason at the
+ * same bytecode, and V8 generalized the feedback there to break the cycle.
+ */
+struct DeoptimizationLoopDetected {
+  // Static string describing the deopt reason, e.g. "wrong map".
+  const char* reason = nullptr;
+  int deopt_count = 0;
+  bool feedback_generalized = false;
+};
+
 struct WasmModuleDecoded {
   WasmModuleDecoded() = default;
   WasmModuleDecoded(bool async, bool streamed, bool success,
@@ -219,6 +230,7 @@ class V8_EXPORT Recorder {
   ADD_MAIN_THREAD_EVENT(GarbageCollectionFullMainThreadIncrementalSweep)
   ADD_MAIN_THREAD_EVENT(GarbageCollectionFullMainThreadBatchedIncrementalSweep)
   ADD_MAIN_THREAD_EVENT(GarbageCollectionYoungCycle)
+  ADD_MAIN_THREAD_EVENT(DeoptimizationLoopDetected)
   ADD_MAIN_THREAD_EVENT(WasmModuleDecoded)
   ADD_MAIN_THREAD_EVENT(WasmModuleCompiled)
   ADD_MAIN_THREAD_EVENT(WasmModuleInstantiated)
@@ -159,6 +159,15 @@ class V8_EXPORT ValueSerializer {
    */
   void WriteHeader();
 
+  /**
+   * Sets the format version to write. The default is version 15, which can be
+   * read by older versions of V8. Newer versions, up to
+   * CurrentValueSerializerFormatVersion(), use more compact encodings, but
+   * can only be read by a V8 that supports them. Returns false if the version
+   * is not supported. Must be called before WriteHeader.
+   */
+  V8_WARN_UNUSED_RESULT bool SetTargetVersion(uint32_t version);
+
   /**
    * Serializes a JavaScript value into the buffer.
    */
@@ -190,6 +199,20 @@ class V8_EXPORT ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /**
+   * Indicate whether to pass large strings by reference instead of copying
+   * their contents into the buffer. Such strings are moved to the shared heap
+   * if they aren't there already, and handed to the deserializing isolate
+   * through the SharedValueConveyor, which then uses them without a copy.
+   *
+   * This only has an effect if --shared-string-table is enabled, and requires
+   * a Delegate that implements AdoptSharedValueConveyor. The deserializing
+   * isolate must be in the same isolate group.
+   *
+   * The default is to copy strings.
+   */
+  void SetShareStrings(bool mode);
+
   /**
    * Write raw data in various common formats to the buffer.
    * Note that integer types are written in base-128 varint format, not with a
@@ -3285,6 +3285,23 @@ MaybeLocal<Value> JSON::Parse(Local<Context> context,
   return api_scope.EscapeMaybe(maybe_result);
 }
 
+MaybeLocal<Value> JSON::ParseWithShapeHint(Local<Context> context,
+                                           Local<String> json_string,
+                                           Local<Object> shape_hint) {
+  PrepareForExecutionScope api_scope{context,
+                                     RCCId::kAPI_JSON_ParseWithShapeHint};
+  i::Isolate* i_isolate = api_scope.i_isolate();
+  auto string = Utils::OpenHandle(*json_string);
+  i::Handle<i::String> source = i::String::Flatten(i_isolate, string);
+  auto hint = Utils::OpenDirectHandle(*shape_hint);
+  auto maybe_result =
+      source->IsOneByteRepresentation()
+          ? i::JsonParser<uint8_t>::ParseWithShapeHint(i_isolate, source, hint)
+          : i::JsonParser<uint16_t>::ParseWithShapeHint(i_isolate, source,
+                                                        hint);
+  return api_scope.EscapeMaybe(maybe_result);
+}
+
 MaybeLocal<String> JSON::Stringify(Local<Context> context,
                                    Local<Value> json_object,
                                    Local<String> gap) {
@@ -3309,6 +3326,30 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   return api_scope.EscapeMaybe(i::Object::ToString(i_isolate, maybe));
 }
 
+Maybe<bool> JSON::StringifyToStream(Local<Context> context,
+                                    Local<Value> json_object,
+                                    OutputStream* stream, Local<String> gap) {
+  PrepareForExecutionScope api_scope{context,
+                                     RCCId::kAPI_JSON_StringifyToStream};
+  i::Isolate* i_isolate = api_scope.i_isolate();
+  i::Handle<i::JSAny> object;
+  if (!Utils::ApiCheck(
+          i::TryCast<i::JSAny>(Utils::OpenHandle(*json_object), &object),
+          "JSON::StringifyToStream",
+          "Invalid object, must be a JSON-serializable object.")) {
+    return {};
+  }
+  if (!Utils::ApiCheck(stream != nullptr, "JSON::StringifyToStream",
+                       "Invalid output stream.")) {
+    return {};
+  }
+  // Unlike in Stringify, a missing gap is passed on as undefined, which keeps
+  // the fast stringifier available.
+  i::Handle<i::Object> gap_object = i_isolate->factory()->undefined_value();
+  if (!gap.IsEmpty()) gap_object = Utils::OpenHandle(*gap);
+  return i::JsonStringifyToStream(i_isolate, object, gap_object, stream);
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 SharedValueConveyor::SharedValueConveyor(SharedValueConveyor&& other) noexcept
@@ -3400,10 +3441,18 @@ ValueSerializer::~ValueSerializer() { delete private_; }
 
 void ValueSerializer::WriteHeader() { private_->serializer.WriteHeader(); }
 
+bool ValueSerializer::SetTargetVersion(uint32_t version) {
+  return private_->serializer.SetTargetVersion(version);
+}
+
 void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   private_->serializer.SetTreatArrayBufferViewsAsHostObjects(mode);
 }
 
+void ValueSerializer::SetShareStrings(bool mode) {
+  private_->serializer.SetShareStrings(mode);
+}
+
 Maybe<bool> ValueSerializer::WriteValue(Local<Context> context,
                                         Local<Value> value) {
   auto i_isolate = i::Isolate::Current();
@@ -11004,6 +11053,9 @@ CALLBACK_SETTER(IsJSApiWrapperNativeErrorCallback,
                 IsJSApiWrapperNativeErrorCallback,
                 is_js_api_wrapper_native_error_callback)
 
+CALLBACK_SETTER(TieringPolicyCallback, TieringPolicyCallback,
+                tiering_policy_callback)
+
 void Isolate::InstallConditionalFeatures(Local<Context> context) {
   v8::HandleScope handle_scope(this);
   v8::Context::Scope context_scope(context);
@@ -9,6 +9,7 @@
 #include "src/base/fpu.h"
 #include "src/baseline/baseline-compiler.h"
 #include "src/codegen/compiler.h"
+#include "src/debug/debug.h"
 #include "src/execution/isolate.h"
 #include "src/handles/global-handles-inl.h"
 #include "src/heap/factory-inl.h"
@@ -50,6 +51,30 @@ class BaselineCompilerTask {
     compiler.GenerateCode();
     maybe_code_ =
         local_isolate->heap()->NewPersistentMaybeHandle(compiler.Build());
+    if (v8_flags.concurrent_sparkplug_off_thread_install) {
+      installed_off_thread_ = TryInstallOffThread(local_isolate);
+    }
+  }
+
+  // Executed in the background thread. Publishes the code on the
+  // SharedFunctionInfo, so that the next call of any closure enters baseline
+  // code without waiting for the main thread. The SFI access mutex keeps the
+  // debugger from attaching debug info between the checks and the store.
+  bool TryInstallOffThread(LocalIsolate* local_isolate) {
+    Handle<Code> code;
+    if (!maybe_code_.ToHandle(&code)) return false;
+    DisallowGarbageCollection no_gc;
+    base::MutexGuard guard(local_isolate->shared_function_info_access());
+    Isolate* isolate = local_isolate->GetMainThreadIsolateUnsafe();
+    if (isolate->debug()->is_active()) return false;
+    Tagged<SharedFunctionInfo> shared = *shared_function_info_;
+    // Leave functions with debug info, flushed or replaced bytecode, or
+    // already installed baseline code to the main thread.
+    if (shared->HasBaselineCode() || !shared->HasBytecodeArray()) return false;
+    if (shared->TryGetDebugInfo(isolate).has_value()) return false;
+    if (shared->GetActiveBytecodeArray(isolate) != *bytecode_) return false;
+    shared->set_baseline_code(*code, kReleaseStore);
+    return true;
   }
 
   // Executed in the main thread.
@@ -60,20 +85,29 @@ class BaselineCompilerTask {
     if (v8_flags.print_code) {
       Print(*code);
     }
-    // Don't install the code if the bytecode has been flushed or has
-    // already some baseline code installed.
-    if (!CanCompileWithConcurrentBaseline(*shared_function_info_, isolate)) {
-      return;
+    if (installed_off_thread_) {
+      // The code may have been flushed or discarded by the debugger since.
+      if (!shared_function_info_->HasBaselineCode() ||
+          shared_function_info_->baseline_code(kAcquireLoad) != *code) {
+        return;
+      }
+    } else {
+      // Don't install the code if the bytecode has been flushed or has
+      // already some baseline code installed.
+      if (!CanCompileWithConcurrentBaseline(*shared_function_info_, isolate)) {
+        return;
+      }
+      shared_function_info_->set_baseline_code(*code, kReleaseStore);
     }
 
-    shared_function_info_->set_baseline_code(*code, kReleaseStore);
     shared_function_info_->set_age(0);
     if (v8_flags.trace_baseline) {
       CodeTracer::Scope scope(isolate->GetCodeTracer());
       std::stringstream ss;
       ss << "[Concurrent Sparkplug Off Thread] Function ";
       ShortPrint(*shared_function_info_, ss);
-      ss << " installed\n";
+      ss << (installed_off_thread_ ? " installed off thread\n"
+                                   : " installed\n");
       OFStream os(scope.file());
       os << ss.str();
     }
@@ -92,6 +126,7 @@ class BaselineCompilerTask {
   IndirectHandle<BytecodeArray> bytecode_;
   MaybeIndirectHandle<Code> maybe_code_;
   base::TimeDelta time_taken_;
+  bool installed_off_thread_ = false;
 };
 
 class BaselineBatchCompilerJob {
@@ -171,6 +206,9 @@ class ConcurrentBaselineCompiler {
         job->Compile(&local_isolate);
         outgoing_queue_->Enqueue(std::move(job));
       }
+      // Even if all code was installed off thread, the main thread still has
+      // to clear the compiling bits and free the persistent handles, which is
+      // cheap.
       isolate_->stack_guard()->RequestInstallBaselineCode();
     }
 
@@ -190,15 +228,7 @@ class ConcurrentBaselineCompiler {
   };
 
   explicit ConcurrentBaselineCompiler(Isolate* isolate) : isolate_(isolate) {
-    if (v8_flags.concurrent_sparkplug) {
-      TaskPriority priority =
-          v8_flags.concurrent_sparkplug_high_priority_threads
-              ? TaskPriority::kUserBlocking
-              : TaskPriority::kUserVisible;
-      job_handle_ = V8::GetCurrentPlatform()->PostJob(
-          priority, std::make_unique<JobDispatcher>(isolate_, &incoming_queue_,
-                                                    &outgoing_queue_));
-    }
+    if (v8_flags.concurrent_sparkplug) PostJob();
   }
 
   ~ConcurrentBaselineCompiler() {
@@ -217,6 +247,20 @@ class ConcurrentBaselineCompiler {
     job_handle_->NotifyConcurrencyIncrease();
   }
 
+  // Waits until all queued batches have been compiled, without installing
+  // them on the main thread.
+  void AwaitCompileJobs() {
+    DCHECK(v8_flags.concurrent_sparkplug);
+    {
+      AllowGarbageCollection allow_before_parking;
+      isolate_->main_thread_local_isolate()->ExecuteMainThreadWhileParked(
+          [this]() { job_handle_->Join(); });
+    }
+    // Join kills the job handle, so post a new one.
+    PostJob();
+    DCHECK(incoming_queue_.IsEmpty());
+  }
+
   void InstallBatch() {
     while (!outgoing_queue_.IsEmpty()) {
       std::unique_ptr<BaselineBatchCompilerJob> job;
@@ -226,6 +270,15 @@ class ConcurrentBaselineCompiler {
   }
 
  private:
+  void PostJob() {
+    TaskPriority priority = v8_flags.concurrent_sparkplug_high_priority_threads
+                                ? TaskPriority::kUserBlocking
+                                : TaskPriority::kUserVisible;
+    job_handle_ = V8::GetCurrentPlatform()->PostJob(
+        priority, std::make_unique<JobDispatcher>(isolate_, &incoming_queue_,
+                                                  &outgoing_queue_));
+  }
+
   Isolate* isolate_;
   std::unique_ptr<JobHandle> job_handle_ = nullptr;
   LockedQueue<std::unique_ptr<BaselineBatchCompilerJob>> incoming_queue_;
@@ -296,6 +349,10 @@ void BaselineBatchCompiler::InstallBatch() {
   concurrent_compiler_->InstallBatch();
 }
 
+void BaselineBatchCompiler::AwaitCompileJobsForTesting() {
+  if (concurrent_compiler_) concurrent_compiler_->AwaitCompileJobs();
+}
+
 void BaselineBatchCompiler::EnsureQueueCapacity() {
   if (compilation_queue_.is_null()) {
     compilation_queue_ = isolate_->global_handles()->Create(
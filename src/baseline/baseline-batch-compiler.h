@@ -32,6 +32,10 @@ class BaselineBatchCompiler {
 
   void InstallBatch();
 
+  // Waits for the background compilation of all batches submitted so far.
+  // The main thread part of their installation is left to InstallBatch().
+  void AwaitCompileJobsForTesting();
+
  private:
   bool concurrent() const;
 
@@ -2860,6 +2860,7 @@ bool Compiler::CollectSourcePositions(
   // Prevent parallel tasks from being spawned by this job.
   flags.set_post_parallel_compile_tasks_for_eager_toplevel(false);
   flags.set_post_parallel_compile_tasks_for_lazy(false);
+  flags.set_post_parallel_compile_tasks_for_compile_hints(false);
 
   UnoptimizedCompileState compile_state;
   ReusableUnoptimizedCompileState reusable_state(isolate);
@@ -1141,6 +1141,9 @@ FUNCTION_REFERENCE(re_case_insensitive_compare_non_unicode,
 FUNCTION_REFERENCE(re_is_character_in_range_array,
                    RegExpMacroAssembler::IsCharacterInRangeArray)
 
+FUNCTION_REFERENCE(re_contains_required_literal,
+                   RegExpMacroAssembler::ContainsRequiredLiteral)
+
 ExternalReference ExternalReference::re_word_character_map() {
   return ExternalReference(
       NativeRegExpMacroAssembler::word_character_map_address());
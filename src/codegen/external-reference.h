@@ -463,6 +463,8 @@ enum class IsolateFieldId : uint8_t;
     "RegExpMacroAssembler::CaseInsensitiveCompareNonUnicode()")                \
   V(re_is_character_in_range_array,                                            \
     "RegExpMacroAssembler::IsCharacterInRangeArray()")                         \
+  V(re_contains_required_literal,                                              \
+    "RegExpMacroAssembler::ContainsRequiredLiteral()")                         \
   V(re_check_stack_guard_state,                                                \
     "RegExpMacroAssembler*::CheckStackGuardState()")                           \
   V(re_grow_stack, "NativeRegExpMacroAssembler::GrowStack()")                  \
@@ -202,6 +202,9 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   // Returns true if there is space available in the input queue.
   inline bool IsQueueAvailable() { return input_queue().IsAvailable(); }
 
+  // Returns the number of jobs waiting for a compile thread.
+  inline size_t InputQueueLength() { return input_queue().Length(); }
+
   static bool Enabled() { return v8_flags.concurrent_recompilation; }
 
   // This method must be called on the main thread.
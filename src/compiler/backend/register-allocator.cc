@@ -34,6 +34,13 @@ static constexpr int kFloat32Bit =
 static constexpr int kSimd128Bit =
     RepresentationBit(MachineRepresentation::kSimd128);
 
+RegisterKind RegisterKindFor(MachineRepresentation rep) {
+  if (kFPAliasing == AliasingKind::kIndependent && IsSimd128(rep)) {
+    return RegisterKind::kSimd128;
+  }
+  return IsFloatingPoint(rep) ? RegisterKind::kDouble : RegisterKind::kGeneral;
+}
+
 const InstructionBlock* GetContainingLoop(const InstructionSequence* sequence,
                                           const InstructionBlock* block) {
   RpoNumber index = block->loop_header();
@@ -275,13 +282,7 @@ void LiveRange::Spill() {
 }
 
 RegisterKind LiveRange::kind() const {
-  if (kFPAliasing == AliasingKind::kIndependent &&
-      IsSimd128(representation())) {
-    return RegisterKind::kSimd128;
-  } else {
-    return IsFloatingPoint(representation()) ? RegisterKind::kDouble
-                                             : RegisterKind::kGeneral;
-  }
+  return RegisterKindFor(representation());
 }
 
 bool LiveRange::RegisterFromFirstHint(int* register_index) {
@@ -1172,8 +1173,9 @@ void RegisterAllocationData::PhiMapValue::CommitAssignment(
 RegisterAllocationData::RegisterAllocationData(
     const RegisterConfiguration* config, Zone* zone, Frame* frame,
     InstructionSequence* code, TickCounter* tick_counter,
-    const char* debug_name)
+    const char* debug_name, Zone* fp_allocation_zone)
     : allocation_zone_(zone),
+      fp_allocation_zone_(fp_allocation_zone),
       frame_(frame),
       code_(code),
       debug_name_(debug_name),
@@ -1195,8 +1197,6 @@ RegisterAllocationData::RegisterAllocationData(
       assigned_double_registers_(nullptr),
       virtual_register_count_(code->VirtualRegisterCount()),
       preassigned_slot_ranges_(zone),
-      spill_state_(code->InstructionBlockCount(), ZoneVector<LiveRange*>(zone),
-                   zone),
       tick_counter_(tick_counter),
       slot_for_const_range_(zone) {
   if (kFPAliasing == AliasingKind::kCombine) {
@@ -1262,8 +1262,10 @@ TopLevelLiveRange* RegisterAllocationData::GetLiveRangeFor(int index) {
 
 TopLevelLiveRange* RegisterAllocationData::NewLiveRange(
     int index, MachineRepresentation rep) {
-  return allocation_zone()->New<TopLevelLiveRange>(index, rep,
-                                                   allocation_zone());
+  // The range's children are added in the zone of the allocator processing
+  // it, which may run concurrently for FP and SIMD registers.
+  Zone* zone = allocation_zone(RegisterKindFor(rep));
+  return zone->New<TopLevelLiveRange>(index, rep, zone);
 }
 
 RegisterAllocationData::PhiMapValue* RegisterAllocationData::InitializePhiMap(
@@ -1349,7 +1351,8 @@ SpillRange* RegisterAllocationData::AssignSpillRangeToLiveRange(
 
   SpillRange* spill_range = range->GetAllocatedSpillRange();
   if (spill_range == nullptr) {
-    spill_range = allocation_zone()->New<SpillRange>(range, allocation_zone());
+    Zone* zone = allocation_zone(range->kind());
+    spill_range = zone->New<SpillRange>(range, zone);
   }
   if (spill_mode == SpillMode::kSpillDeferred &&
       (range->spill_type() != SpillType::kSpillRange)) {
@@ -2730,6 +2733,17 @@ RegisterAllocator::RegisterAllocator(RegisterAllocationData* data,
   }
 }
 
+bool RegisterAllocator::IsVirtualRegisterOfThisKind(int vreg) const {
+  return RegisterKindFor(code()->GetRepresentation(vreg)) == mode();
+}
+
+void RegisterAllocator::MaybeTick() {
+  if (mode() == RegisterKind::kGeneral ||
+      !data()->allocates_fp_registers_concurrently()) {
+    data()->tick_counter()->TickAndMaybeEnterSafepoint();
+  }
+}
+
 LifetimePosition RegisterAllocator::GetSplitPositionForInstruction(
     const LiveRange* range, int instruction_index) {
   LifetimePosition ret = LifetimePosition::Invalid();
@@ -2746,6 +2760,7 @@ void RegisterAllocator::SplitAndSpillRangesDefinedByMemoryOperand() {
   for (size_t i = 0; i < initial_range_count; ++i) {
     CHECK_EQ(initial_range_count,
              data()->live_ranges().size());  // TODO(neis): crbug.com/831822
+    if (!IsVirtualRegisterOfThisKind(static_cast<int>(i))) continue;
     TopLevelLiveRange* range = data()->live_ranges()[i];
     if (!CanProcessRange(range)) continue;
     // Only assume defined by memory operand if we are guaranteed to spill it or
@@ -2949,6 +2964,8 @@ LinearScanAllocator::LinearScanAllocator(RegisterAllocationData* data,
       active_live_ranges_(local_zone),
       inactive_live_ranges_(num_registers(), InactiveLiveRangeQueue(local_zone),
                             local_zone),
+      spill_state_(code()->InstructionBlockCount(),
+                   ZoneVector<LiveRange*>(local_zone), local_zone),
       next_active_ranges_change_(LifetimePosition::Invalid()),
       next_inactive_ranges_change_(LifetimePosition::Invalid()) {
   active_live_ranges().reserve(8);
@@ -3198,8 +3215,8 @@ RpoNumber LinearScanAllocator::ChooseOneOfTwoPredecessorStates(
   // We count uses only for live ranges that are unique to either the left or
   // the right predecessor since many live ranges are shared between both.
   // Shared ranges don't influence the decision anyway and this is faster.
-  auto& left = data()->GetSpillState(current_block->predecessors()[0]);
-  auto& right = data()->GetSpillState(current_block->predecessors()[1]);
+  auto& left = GetSpillState(current_block->predecessors()[0]);
+  auto& right = GetSpillState(current_block->predecessors()[1]);
 
   // Build a set of the `TopLevelLiveRange`s in the left predecessor.
   // Usually this set is very small, e.g., for JetStream2 at most 3 ranges in
@@ -3315,7 +3332,7 @@ void LinearScanAllocator::ComputeStateFromManyPredecessors(
   using RangeVoteMap =
       SmallZoneMap<TopLevelLiveRange*, Vote, 16, TopLevelLiveRangeComparator>;
   static_assert(sizeof(RangeVoteMap) < 4096, "too large stack allocation");
-  RangeVoteMap counts(data()->allocation_zone());
+  RangeVoteMap counts(allocation_zone());
 
   int deferred_blocks = 0;
   for (RpoNumber pred : current_block->predecessors()) {
@@ -3324,7 +3341,7 @@ void LinearScanAllocator::ComputeStateFromManyPredecessors(
       deferred_blocks++;
       continue;
     }
-    const auto& pred_state = data()->GetSpillState(pred);
+    const auto& pred_state = GetSpillState(pred);
     for (LiveRange* range : pred_state) {
       // We might have spilled the register backwards, so the range we
       // stored might have lost its register. Ignore those.
@@ -3451,7 +3468,7 @@ void LinearScanAllocator::UpdateDeferredFixedRanges(SpillMode spill_mode,
               other->TopLevel()->vreg(),
               RegisterName(other->assigned_register()));
         LiveRange* split_off =
-            other->SplitAt(next_start, data()->allocation_zone());
+            other->SplitAt(next_start, allocation_zone());
         // Try to get the same register after the deferred block.
         split_off->set_controlflow_hint(other->assigned_register());
         DCHECK_NE(split_off, other);
@@ -3570,7 +3587,6 @@ void LinearScanAllocator::AllocateRegisters() {
   }
 
   SplitAndSpillRangesDefinedByMemoryOperand();
-  data()->ResetSpillState();
 
   if (v8_flags.trace_turbo_alloc) {
     PrintRangeOverview();
@@ -3580,6 +3596,7 @@ void LinearScanAllocator::AllocateRegisters() {
   for (TopLevelLiveRange* range : data()->live_ranges()) {
     CHECK_EQ(live_ranges_size,
              data()->live_ranges().size());  // TODO(neis): crbug.com/831822
+    if (!IsVirtualRegisterOfThisKind(range->vreg())) continue;
     if (!CanProcessRange(range)) continue;
     for (LiveRange* to_add = range; to_add != nullptr;
          to_add = to_add->next()) {
@@ -3646,7 +3663,7 @@ void LinearScanAllocator::AllocateRegisters() {
   // breaks with the invariant that we undo spills that happen in deferred code
   // when crossing a deferred/non-deferred boundary.
   while (!unhandled_live_ranges().empty() || last_block < max_blocks) {
-    data()->tick_counter()->TickAndMaybeEnterSafepoint();
+    MaybeTick();
     LiveRange* current = unhandled_live_ranges().empty()
                              ? nullptr
                              : *unhandled_live_ranges().begin();
@@ -3672,7 +3689,7 @@ void LinearScanAllocator::AllocateRegisters() {
       // Store current spill state (as the state at end of block). For
       // simplicity, we store the active ranges, e.g., the live ranges that
       // are not spilled.
-      data()->RememberSpillState(last_block, active_live_ranges());
+      RememberSpillState(last_block, active_live_ranges());
 
       // Only reset the state if this was not a direct fallthrough. Otherwise
       // control flow resolution will get confused (it does not expect changes
@@ -3734,7 +3751,7 @@ void LinearScanAllocator::AllocateRegisters() {
           // boundary, there is nothing to do.
           bool is_noop = pred.IsNext(current_block->rpo_number());
           if (!is_noop) {
-            auto& spill_state = data()->GetSpillState(pred);
+            auto& spill_state = GetSpillState(pred);
             TRACE("Not a fallthrough. Adding %zu elements...\n",
                   spill_state.size());
             LifetimePosition pred_end =
@@ -242,7 +242,8 @@ class RegisterAllocationData final : public ZoneObject {
   RegisterAllocationData(const RegisterConfiguration* config,
                          Zone* allocation_zone, Frame* frame,
                          InstructionSequence* code, TickCounter* tick_counter,
-                         const char* debug_name = nullptr);
+                         const char* debug_name = nullptr,
+                         Zone* fp_allocation_zone = nullptr);
 
   const ZoneVector<TopLevelLiveRange*>& live_ranges() const {
     return live_ranges_;
@@ -279,6 +280,17 @@ class RegisterAllocationData final : public ZoneObject {
   // This zone is for data structures only needed during register allocation
   // phases.
   Zone* allocation_zone() const { return allocation_zone_; }
+  // Live ranges of the given kind (and their splits and spill ranges) are
+  // allocated in this zone. FP and SIMD ranges use a separate zone if their
+  // registers are allocated concurrently with the general registers.
+  Zone* allocation_zone(RegisterKind kind) const {
+    return kind == RegisterKind::kGeneral || fp_allocation_zone_ == nullptr
+               ? allocation_zone_
+               : fp_allocation_zone_;
+  }
+  bool allocates_fp_registers_concurrently() const {
+    return fp_allocation_zone_ != nullptr;
+  }
   // This zone is for InstructionOperands and moves that live beyond register
   // allocation.
   Zone* code_zone() const { return code()->zone(); }
@@ -318,22 +330,6 @@ class RegisterAllocationData final : public ZoneObject {
     return preassigned_slot_ranges_;
   }
 
-  void RememberSpillState(RpoNumber block,
-                          const ZoneVector<LiveRange*>& state) {
-    spill_state_[block.ToSize()] = state;
-  }
-
-  ZoneVector<LiveRange*>& GetSpillState(RpoNumber block) {
-    auto& result = spill_state_[block.ToSize()];
-    return result;
-  }
-
-  void ResetSpillState() {
-    for (auto& state : spill_state_) {
-      state.clear();
-    }
-  }
-
   TickCounter* tick_counter() { return tick_counter_; }
 
   ZoneMap<TopLevelLiveRange*, AllocatedOperand*>& slot_for_const_range() {
@@ -342,6 +338,7 @@ class RegisterAllocationData final : public ZoneObject {
 
  private:
   Zone* const allocation_zone_;
+  Zone* const fp_allocation_zone_;
   Frame* const frame_;
   InstructionSequence* const code_;
   const char* const debug_name_;
@@ -363,7 +360,6 @@ class RegisterAllocationData final : public ZoneObject {
   BitVector* fixed_simd128_register_use_;
   int virtual_register_count_;
   RangesWithPreassignedSlots preassigned_slot_ranges_;
-  ZoneVector<ZoneVector<LiveRange*>> spill_state_;
   TickCounter* const tick_counter_;
   ZoneMap<TopLevelLiveRange*, AllocatedOperand*> slot_for_const_range_;
 };
@@ -1483,7 +1479,16 @@ class RegisterAllocator : public ZoneObject {
   LifetimePosition GetSplitPositionForInstruction(const LiveRange* range,
                                                   int instruction_index);
 
-  Zone* allocation_zone() const { return data()->allocation_zone(); }
+  Zone* allocation_zone() const { return data()->allocation_zone(mode()); }
+
+  // Returns true iff. the live range of {vreg} has to be processed by this
+  // allocator. Only looks at the instruction sequence, so that it does not
+  // race with an allocator for another register kind running concurrently.
+  bool IsVirtualRegisterOfThisKind(int vreg) const;
+
+  // Ticks and safepoints are only done on the compiling thread, FP registers
+  // may be allocated on a helper thread.
+  void MaybeTick();
 
   // Find the optimal split for ranges defined by a memory operand, e.g.
   // constants or function parameters passed on the stack.
@@ -1563,6 +1568,15 @@ class LinearScanAllocator final : public RegisterAllocator {
   void ReloadLiveRanges(RangeRegisterSmallMap const& to_be_live,
                         LifetimePosition position);
 
+  void RememberSpillState(RpoNumber block,
+                          const ZoneVector<LiveRange*>& state) {
+    spill_state_[block.ToSize()] = state;
+  }
+
+  ZoneVector<LiveRange*>& GetSpillState(RpoNumber block) {
+    return spill_state_[block.ToSize()];
+  }
+
   void UpdateDeferredFixedRanges(SpillMode spill_mode, InstructionBlock* block);
   bool BlockIsDeferredOrImmediatePredecessorIsNotDeferred(
       const InstructionBlock* block);
@@ -1682,6 +1696,10 @@ class LinearScanAllocator final : public RegisterAllocator {
   UnhandledLiveRangeQueue unhandled_live_ranges_;
   ZoneVector<LiveRange*> active_live_ranges_;
   ZoneVector<InactiveLiveRangeQueue> inactive_live_ranges_;
+  // The active ranges at the end of each block, used to pick the register
+  // state at control flow merges. Kept per allocator, since allocators for
+  // different register kinds may run concurrently.
+  ZoneVector<ZoneVector<LiveRange*>> spill_state_;
 
   // Approximate at what position the set of ranges will change next.
   // Used to avoid scanning for updates even if none are present.
@@ -16,14 +16,35 @@
 
 namespace v8::internal::compiler::turboshaft {
 
+namespace {
+
+bool ShouldAllocateFPRegistersConcurrently(const InstructionSequence* code) {
+  if (!v8_flags.turbo_concurrent_register_allocation) return false;
+  // With combined FP aliasing, float and double registers share the
+  // bookkeeping of the general allocation phases.
+  if (kFPAliasing == AliasingKind::kCombine) return false;
+  if (v8_flags.trace_turbo_alloc) return false;
+  if (!code->HasFPVirtualRegisters()) return false;
+  return static_cast<int>(code->instructions().size()) >=
+         v8_flags.turbo_concurrent_register_allocation_min_instructions;
+}
+
+}  // namespace
+
 void PipelineData::InitializeRegisterComponent(
     const RegisterConfiguration* config, CallDescriptor* call_descriptor) {
   DCHECK(!register_component_.has_value());
   register_component_.emplace(zone_stats());
   auto& zone = register_component_->zone;
+  Zone* fp_zone = nullptr;
+  if (ShouldAllocateFPRegistersConcurrently(sequence())) {
+    register_component_->fp_zone.emplace(zone_stats(),
+                                         kRegisterAllocationZoneName);
+    fp_zone = register_component_->fp_zone->get();
+  }
   register_component_->allocation_data = zone.New<RegisterAllocationData>(
       config, zone, frame(), sequence(), &info()->tick_counter(),
-      debug_name_.get());
+      debug_name_.get(), fp_zone);
 }
 
 AccountingAllocator* PipelineData::allocator() const {
@@ -161,6 +161,9 @@ struct RegisterComponent
   using ComponentWithZone::ComponentWithZone;
 
   Pointer<RegisterAllocationData> allocation_data = nullptr;
+  // Holds the FP and SIMD live ranges if their registers are allocated
+  // concurrently with the general registers.
+  std::optional<ZoneWithName<kRegisterAllocationZoneName>> fp_zone;
 };
 }  // namespace detail
 
@@ -67,15 +67,20 @@ bool Pipeline::AllocateRegisters(const RegisterConfiguration* config,
                                        data_->register_allocation_data());
   }
 
-  RUN_MAYBE_ABORT(AllocateGeneralRegistersPhase<LinearScanAllocator>);
-
-  if (data_->sequence()->HasFPVirtualRegisters()) {
-    RUN_MAYBE_ABORT(AllocateFPRegistersPhase<LinearScanAllocator>);
-  }
+  if (data_->register_allocation_data()
+          ->allocates_fp_registers_concurrently()) {
+    RUN_MAYBE_ABORT(AllocateRegistersConcurrentlyPhase<LinearScanAllocator>);
+  } else {
+    RUN_MAYBE_ABORT(AllocateGeneralRegistersPhase<LinearScanAllocator>);
+
+    if (data_->sequence()->HasFPVirtualRegisters()) {
+      RUN_MAYBE_ABORT(AllocateFPRegistersPhase<LinearScanAllocator>);
+    }
 
-  if (data_->sequence()->HasSimd128VirtualRegisters() &&
-      (kFPAliasing == AliasingKind::kIndependent)) {
-    RUN_MAYBE_ABORT(AllocateSimd128RegistersPhase<LinearScanAllocator>);
+    if (data_->sequence()->HasSimd128VirtualRegisters() &&
+        (kFPAliasing == AliasingKind::kIndependent)) {
+      RUN_MAYBE_ABORT(AllocateSimd128RegistersPhase<LinearScanAllocator>);
+    }
   }
 
   RUN_MAYBE_ABORT(DecideSpillingModePhase);
@@ -5,6 +5,10 @@
 #ifndef V8_COMPILER_TURBOSHAFT_REGISTER_ALLOCATION_PHASE_H_
 #define V8_COMPILER_TURBOSHAFT_REGISTER_ALLOCATION_PHASE_H_
 
+#include <atomic>
+#include <memory>
+
+#include "include/v8-platform.h"
 #include "src/compiler/backend/frame-elider.h"
 #include "src/compiler/backend/jump-threading.h"
 #include "src/compiler/backend/move-optimizer.h"
@@ -13,6 +17,7 @@
 #include "src/compiler/turboshaft/copying-phase.h"
 #include "src/compiler/turboshaft/phase.h"
 #include "src/compiler/turboshaft/value-numbering-reducer.h"
+#include "src/init/v8.h"
 
 namespace v8::internal::compiler::turboshaft {
 
@@ -92,6 +97,62 @@ struct AllocateSimd128RegistersPhase {
   }
 };
 
+// Allocates the FP (and, with independent FP aliasing, the SIMD) registers.
+// Only runs once: either on a worker thread or on the joining thread.
+template <typename RegAllocator>
+class FPRegisterAllocationJob final : public JobTask {
+ public:
+  FPRegisterAllocationJob(RegisterAllocationData* data,
+                          AccountingAllocator* allocator)
+      : data_(data), allocator_(allocator) {}
+
+  void Run(JobDelegate* delegate) override {
+    if (started_.exchange(true, std::memory_order_relaxed)) return;
+    Zone local_zone(allocator_, ZONE_NAME);
+    {
+      RegAllocator allocator(data_, RegisterKind::kDouble, &local_zone);
+      allocator.AllocateRegisters();
+    }
+    if (data_->code()->HasSimd128VirtualRegisters() &&
+        (kFPAliasing == AliasingKind::kIndependent)) {
+      RegAllocator allocator(data_, RegisterKind::kSimd128, &local_zone);
+      allocator.AllocateRegisters();
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    return started_.load(std::memory_order_relaxed) ? 0 : 1;
+  }
+
+ private:
+  RegisterAllocationData* const data_;
+  AccountingAllocator* const allocator_;
+  std::atomic<bool> started_{false};
+};
+
+// Runs the general register allocation on the compiling thread while the FP
+// and SIMD registers are allocated by a job. The live ranges of the different
+// register kinds are disjoint, and the FP ranges live in their own zone (see
+// {RegisterAllocationData::allocation_zone(RegisterKind)}).
+template <typename RegAllocator>
+struct AllocateRegistersConcurrentlyPhase {
+  DECL_TURBOSHAFT_PHASE_CONSTANTS_WITH_LEGACY_NAME(
+      AllocateRegistersConcurrently)
+  static constexpr bool kOutputIsTraceableGraph = false;
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    RegisterAllocationData* allocation_data = data->register_allocation_data();
+    DCHECK(allocation_data->allocates_fp_registers_concurrently());
+    std::unique_ptr<JobHandle> fp_job = V8::GetCurrentPlatform()->PostJob(
+        TaskPriority::kUserVisible,
+        std::make_unique<FPRegisterAllocationJob<RegAllocator>>(
+            allocation_data, data->allocator()));
+    RegAllocator allocator(allocation_data, RegisterKind::kGeneral, temp_zone);
+    allocator.AllocateRegisters();
+    fp_job->Join();
+  }
+};
+
 struct DecideSpillingModePhase {
   DECL_TURBOSHAFT_PHASE_CONSTANTS_WITH_LEGACY_NAME(DecideSpillingMode)
   static constexpr bool kOutputIsTraceableGraph = false;
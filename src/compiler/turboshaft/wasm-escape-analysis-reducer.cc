@@ -0,0 +1,88 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/wasm-escape-analysis-reducer.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+void WasmEscapeAnalysisAnalyzer::Run() {
+  CollectCandidates();
+  if (allocation_of_.empty()) return;
+  FindEscapingAllocations();
+}
+
+bool WasmEscapeAnalysisAnalyzer::IsCandidate(
+    const WasmAllocateStructOp& alloc) const {
+  if (alloc.is_shared) return false;
+  for (uint32_t i = 0; i < alloc.struct_type->field_count(); ++i) {
+    if (alloc.struct_type->field(i).is_packed()) return false;
+  }
+  return true;
+}
+
+// Collects the struct allocations that could be replaced, and the type
+// annotations of them. A type annotation always comes after its input in the
+// graph.
+void WasmEscapeAnalysisAnalyzer::CollectCandidates() {
+  for (const Operation& op : graph_.AllOperations()) {
+    if (ShouldSkipOperation(op)) continue;
+    OpIndex op_index = graph_.Index(op);
+    if (const WasmAllocateStructOp* alloc = op.TryCast<WasmAllocateStructOp>()) {
+      if (IsCandidate(*alloc)) allocation_of_.emplace(op_index, op_index);
+    } else if (const WasmTypeAnnotationOp* annotation =
+                   op.TryCast<WasmTypeAnnotationOp>()) {
+      OpIndex alloc = NonEscapingAllocation(annotation->value());
+      if (alloc.valid()) allocation_of_.emplace(op_index, alloc);
+    }
+  }
+}
+
+void WasmEscapeAnalysisAnalyzer::FindEscapingAllocations() {
+  for (const Operation& op : graph_.AllOperations()) {
+    if (ShouldSkipOperation(op)) continue;
+    for (OpIndex input : op.inputs()) {
+      OpIndex alloc = NonEscapingAllocation(input);
+      if (alloc.valid() && EscapesThroughUse(input, op)) {
+        escaping_.insert(alloc);
+      }
+    }
+  }
+
+  // Allocations are replaced or kept as a whole, so an optimization step is
+  // only counted for the allocations themselves.
+  for (const auto& [object, alloc] : allocation_of_) {
+    if (object == alloc && !escaping_.contains(alloc) &&
+        ShouldSkipOptimizationStep()) {
+      escaping_.insert(alloc);
+    }
+  }
+
+  for (auto it = allocation_of_.begin(); it != allocation_of_.end();) {
+    if (escaping_.contains(it->second)) {
+      allocation_of_.erase(it++);
+    } else {
+      ++it;
+    }
+  }
+}
+
+// Returns true if {use} makes the allocation referred to by {object} escape.
+bool WasmEscapeAnalysisAnalyzer::EscapesThroughUse(OpIndex object,
+                                                   const Operation& use) const {
+  if (const StructGetOp* struct_get = use.TryCast<StructGetOp>()) {
+    return struct_get->is_atomic();
+  }
+  if (const StructSetOp* struct_set = use.TryCast<StructSetOp>()) {
+    // Writing to the struct is fine, writing the struct somewhere is not.
+    return struct_set->value() == object ||
+           struct_set->memory_order.has_value();
+  }
+  if (use.Is<WasmTypeAnnotationOp>()) {
+    // The uses of the annotation are checked separately.
+    return false;
+  }
+  return true;
+}
+
+}  // namespace v8::internal::compiler::turboshaft
@@ -0,0 +1,136 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_TURBOSHAFT_WASM_ESCAPE_ANALYSIS_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_WASM_ESCAPE_ANALYSIS_REDUCER_H_
+
+#if !V8_ENABLE_WEBASSEMBLY
+#error This header should only be included if WebAssembly is enabled.
+#endif  // !V8_ENABLE_WEBASSEMBLY
+
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/graph.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/phase.h"
+#include "src/compiler/turboshaft/utils.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+// The WasmEscapeAnalysisReducer scalar-replaces struct allocations that do
+// not escape the function, e.g.:
+//   (struct.new $Pair (local.get 0) (local.get 1))
+//   local.set $p
+//   ...
+//   (i32.add (struct.get $Pair 0 (local.get $p))
+//            (struct.get $Pair 1 (local.get $p)))
+// An allocation does not escape if it is only used as the object of
+// (non-atomic) struct.get and struct.set operations, possibly through type
+// annotations. Such an allocation is removed, and each of its fields is
+// replaced by a Variable, so that the VariableReducer inserts the phis needed
+// for fields that are written in branches or loops.
+// Structs with packed fields are not replaced, as reading them would require
+// re-extending the stored values.
+class WasmEscapeAnalysisAnalyzer {
+ public:
+  WasmEscapeAnalysisAnalyzer(const Graph& graph, Zone* phase_zone)
+      : graph_(graph), allocation_of_(phase_zone), escaping_(phase_zone) {}
+
+  void Run();
+
+  // Returns the non-escaping allocation that {object} refers to, either
+  // directly or through type annotations. Returns an invalid index if
+  // {object} is not a non-escaping allocation.
+  OpIndex NonEscapingAllocation(OpIndex object) const {
+    auto it = allocation_of_.find(object);
+    return it == allocation_of_.end() ? OpIndex::Invalid() : it->second;
+  }
+
+ private:
+  bool IsCandidate(const WasmAllocateStructOp& alloc) const;
+  void CollectCandidates();
+  void FindEscapingAllocations();
+  bool EscapesThroughUse(OpIndex object, const Operation& use) const;
+
+  const Graph& graph_;
+  // Maps candidate allocations and their type annotations to the allocation.
+  ZoneAbslFlatHashMap<OpIndex, OpIndex> allocation_of_;
+  ZoneAbslFlatHashSet<OpIndex> escaping_;
+};
+
+template <class Next>
+class WasmEscapeAnalysisReducer : public Next {
+ public:
+  TURBOSHAFT_REDUCER_BOILERPLATE(WasmEscapeAnalysis)
+
+  void Analyze() {
+    if (v8_flags.turboshaft_wasm_escape_analysis) analyzer_.Run();
+    Next::Analyze();
+  }
+
+  V<WasmStruct> REDUCE_INPUT_GRAPH(WasmAllocateStruct)(
+      V<WasmStruct> ig_index, const WasmAllocateStructOp& alloc) {
+    if (!analyzer_.NonEscapingAllocation(ig_index).valid()) {
+      return Next::ReduceInputGraphWasmAllocateStruct(ig_index, alloc);
+    }
+    // Replace the allocation by one Variable per field. The graph builder
+    // initializes all fields right after the allocation.
+    ZoneVector<Variable> fields(__ phase_zone());
+    fields.reserve(alloc.struct_type->field_count());
+    for (uint32_t i = 0; i < alloc.struct_type->field_count(); ++i) {
+      fields.push_back(
+          __ NewVariable(RepresentationFor(alloc.struct_type->field(i))));
+    }
+    field_variables_.emplace(ig_index, std::move(fields));
+    return V<WasmStruct>::Invalid();
+  }
+
+  V<Object> REDUCE_INPUT_GRAPH(WasmTypeAnnotation)(
+      V<Object> ig_index, const WasmTypeAnnotationOp& type_annotation) {
+    if (analyzer_.NonEscapingAllocation(ig_index).valid()) {
+      return V<Object>::Invalid();
+    }
+    return Next::ReduceInputGraphWasmTypeAnnotation(ig_index, type_annotation);
+  }
+
+  V<Any> REDUCE_INPUT_GRAPH(StructGet)(V<Any> ig_index,
+                                       const StructGetOp& struct_get) {
+    OpIndex alloc = analyzer_.NonEscapingAllocation(struct_get.object());
+    if (!alloc.valid()) {
+      return Next::ReduceInputGraphStructGet(ig_index, struct_get);
+    }
+    return __ GetVariable(FieldVariable(alloc, struct_get.field_index));
+  }
+
+  V<None> REDUCE_INPUT_GRAPH(StructSet)(V<None> ig_index,
+                                        const StructSetOp& struct_set) {
+    OpIndex alloc = analyzer_.NonEscapingAllocation(struct_set.object());
+    if (!alloc.valid()) {
+      return Next::ReduceInputGraphStructSet(ig_index, struct_set);
+    }
+    __ SetVariable(FieldVariable(alloc, struct_set.field_index),
+                   __ MapToNewGraph(struct_set.value()));
+    return V<None>::Invalid();
+  }
+
+ private:
+  Variable FieldVariable(OpIndex alloc, int field_index) {
+    auto it = field_variables_.find(alloc);
+    DCHECK(it != field_variables_.end());
+    return it->second[field_index];
+  }
+
+  WasmEscapeAnalysisAnalyzer analyzer_{Asm().input_graph(),
+                                       Asm().phase_zone()};
+  ZoneAbslFlatHashMap<OpIndex, ZoneVector<Variable>> field_variables_{
+      Asm().phase_zone()};
+};
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_WASM_ESCAPE_ANALYSIS_REDUCER_H_
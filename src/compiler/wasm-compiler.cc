@@ -908,7 +908,8 @@ class WasmWrapperGraphBuilder : public WasmGraphBuilder {
     return end.PhiAt(0);
   }
 
-  void BuildJSFastApiCallWrapper(DirectHandle<JSReceiver> callable) {
+  void BuildJSFastApiCallWrapper(DirectHandle<JSReceiver> callable,
+                                 int c_function_index) {
     // Here 'callable_node' must be equal to 'callable' but we cannot pass a
     // HeapConstant(callable) because WasmCode::Validate() fails with
     // Unexpected mode: FULL_EMBEDDED_OBJECT.
@@ -956,9 +957,11 @@ class WasmWrapperGraphBuilder : public WasmGraphBuilder {
 
     Tagged<SharedFunctionInfo> shared = target->shared();
     Tagged<FunctionTemplateInfo> api_func_data = shared->api_func_data();
-    const Address c_address = api_func_data->GetCFunction(isolate, 0);
+    DCHECK_LT(c_function_index, api_func_data->GetCFunctionsCount());
+    const Address c_address =
+        api_func_data->GetCFunction(isolate, c_function_index);
     const v8::CFunctionInfo* c_signature =
-        api_func_data->GetCSignature(isolate, 0);
+        api_func_data->GetCSignature(isolate, c_function_index);
 
 #ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
     Address c_functions[] = {c_address};
@@ -1195,7 +1198,8 @@ bool IsFastCallSupportedSignature(const v8::CFunctionInfo* sig) {
 }
 
 wasm::WasmCompilationResult CompileWasmJSFastCallWrapper(
-    const wasm::CanonicalSig* sig, DirectHandle<JSReceiver> callable) {
+    const wasm::CanonicalSig* sig, DirectHandle<JSReceiver> callable,
+    int c_function_index) {
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.wasm.detailed"),
                "wasm.CompileWasmJSFastCallWrapper");
 
@@ -1212,7 +1216,7 @@ wasm::WasmCompilationResult CompileWasmJSFastCallWrapper(
                     1 /* offset for first parameter index being -1 */ +
                     1 /* Wasm instance */ + 1 /* kExtraCallableParam */;
   builder.Start(param_count);
-  builder.BuildJSFastApiCallWrapper(callable);
+  builder.BuildJSFastApiCallWrapper(callable, c_function_index);
 
   // Run the compiler pipeline to generate machine code.
   CallDescriptor* call_descriptor =
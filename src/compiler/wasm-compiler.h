@@ -77,9 +77,11 @@ wasm::WasmCompilationResult CompileWasmCapiCallWrapper(
     const wasm::CanonicalSig*);
 
 bool IsFastCallSupportedSignature(const v8::CFunctionInfo*);
-// Compiles a wrapper to call a Fast API function from Wasm.
+// Compiles a wrapper to call the Fast API function overload with index
+// {c_function_index} of {callable} from Wasm.
 wasm::WasmCompilationResult CompileWasmJSFastCallWrapper(
-    const wasm::CanonicalSig*, DirectHandle<JSReceiver> callable);
+    const wasm::CanonicalSig*, DirectHandle<JSReceiver> callable,
+    int c_function_index);
 
 // Returns a TurboshaftCompilationJob object for a JS to Wasm wrapper.
 std::unique_ptr<OptimizedCompilationJob> NewJSToWasmCompilationJob(
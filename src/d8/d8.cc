@@ -32,6 +32,7 @@
 #include "include/v8-json.h"
 #include "include/v8-locker.h"
 #include "include/v8-profiler.h"
+#include "include/v8-value-serializer-version.h"
 #include "include/v8-wasm.h"
 #include "src/api/api-inl.h"
 #include "src/base/cpu.h"
@@ -2774,6 +2775,8 @@ void Shell::SerializerSerialize(
   Local<Context> context = isolate->GetCurrentContext();
 
   ValueSerializer serializer(isolate);
+  // The data is only read by this d8, so use the latest format.
+  CHECK(serializer.SetTargetVersion(CurrentValueSerializerFormatVersion()));
   serializer.WriteHeader();
   for (int i = 0; i < info.Length(); i++) {
     bool ok;
@@ -6162,7 +6165,11 @@ class Serializer : public ValueSerializer::Delegate {
   explicit Serializer(Isolate* isolate)
       : isolate_(isolate),
         serializer_(isolate, this),
-        current_memory_usage_(0) {}
+        current_memory_usage_(0) {
+    // All isolates of d8 share a heap, so messages can pass strings without
+    // copying them.
+    serializer_.SetShareStrings(i::v8_flags.shared_string_table);
+  }
 
   Serializer(const Serializer&) = delete;
   Serializer& operator=(const Serializer&) = delete;
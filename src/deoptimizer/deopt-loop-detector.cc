@@ -0,0 +1,150 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/deoptimizer/deopt-loop-detector.h"
+
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/ic/ic.h"
+#include "src/interpreter/bytecode-array-iterator.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+
+namespace v8 {
+namespace internal {
+
+int DeoptLoopDetector::RecordDeopt(Tagged<SharedFunctionInfo> shared,
+                                   BytecodeOffset bytecode_offset,
+                                   DeoptimizeReason reason) {
+  DisallowGarbageCollection no_gc;
+  if (bytecode_offset.IsNone() || bytecode_offset.ToInt() < 0) return 0;
+  Tagged<Object> script = shared->script();
+  if (!IsScript(script)) return 0;
+
+  Site site{Cast<Script>(script)->id(),
+            shared->function_literal_id(kRelaxedLoad), bytecode_offset.ToInt(),
+            reason};
+  auto it = deopt_counts_.find(site);
+  if (it == deopt_counts_.end()) {
+    if (deopt_counts_.size() >= kMaxTrackedSites) deopt_counts_.clear();
+    it = deopt_counts_.emplace(site, 0).first;
+  }
+  int count = ++it->second;
+  if (count < v8_flags.deopt_loop_threshold) return 0;
+  deopt_counts_.erase(it);
+  return count;
+}
+
+namespace {
+
+// Returns the index of the feedback slot operand of the bytecodes whose
+// feedback FeedbackNexus::Generalize() can widen, or -1 for all others. Other
+// bytecodes also take kIdx operands, e.g. constant pool or context indices, so
+// the slot can't be inferred from the operand types.
+int FeedbackSlotOperandIndex(interpreter::Bytecode bytecode) {
+  using interpreter::Bytecode;
+  switch (bytecode) {
+    case Bytecode::kInc:
+    case Bytecode::kDec:
+    case Bytecode::kNegate:
+    case Bytecode::kBitwiseNot:
+    case Bytecode::kToNumber:
+    case Bytecode::kToNumeric:
+      return 0;
+    case Bytecode::kAdd:
+    case Bytecode::kSub:
+    case Bytecode::kMul:
+    case Bytecode::kDiv:
+    case Bytecode::kMod:
+    case Bytecode::kExp:
+    case Bytecode::kBitwiseOr:
+    case Bytecode::kBitwiseXor:
+    case Bytecode::kBitwiseAnd:
+    case Bytecode::kShiftLeft:
+    case Bytecode::kShiftRight:
+    case Bytecode::kShiftRightLogical:
+    case Bytecode::kAdd_LhsIsStringConstant_Internalize:
+    case Bytecode::kAddSmi:
+    case Bytecode::kSubSmi:
+    case Bytecode::kMulSmi:
+    case Bytecode::kDivSmi:
+    case Bytecode::kModSmi:
+    case Bytecode::kExpSmi:
+    case Bytecode::kBitwiseOrSmi:
+    case Bytecode::kBitwiseXorSmi:
+    case Bytecode::kBitwiseAndSmi:
+    case Bytecode::kShiftLeftSmi:
+    case Bytecode::kShiftRightSmi:
+    case Bytecode::kShiftRightLogicalSmi:
+    case Bytecode::kTestEqual:
+    case Bytecode::kTestEqualStrict:
+    case Bytecode::kTestLessThan:
+    case Bytecode::kTestGreaterThan:
+    case Bytecode::kTestLessThanOrEqual:
+    case Bytecode::kTestGreaterThanOrEqual:
+    case Bytecode::kTestIn:
+    case Bytecode::kGetKeyedProperty:
+    case Bytecode::kCallUndefinedReceiver0:
+    case Bytecode::kConstructForwardAllArgs:
+      return 1;
+    case Bytecode::kGetNamedProperty:
+    case Bytecode::kGetNamedPropertyFromSuper:
+    case Bytecode::kSetNamedProperty:
+    case Bytecode::kDefineNamedOwnProperty:
+    case Bytecode::kSetKeyedProperty:
+    case Bytecode::kStaInArrayLiteral:
+    case Bytecode::kCallProperty0:
+    case Bytecode::kCallUndefinedReceiver1:
+      return 2;
+    case Bytecode::kGetEnumeratedKeyedProperty:
+    case Bytecode::kDefineKeyedOwnProperty:
+    case Bytecode::kDefineKeyedOwnPropertyInLiteral:
+    case Bytecode::kCallAnyReceiver:
+    case Bytecode::kCallProperty:
+    case Bytecode::kCallProperty1:
+    case Bytecode::kCallUndefinedReceiver:
+    case Bytecode::kCallUndefinedReceiver2:
+    case Bytecode::kCallWithSpread:
+    case Bytecode::kConstruct:
+    case Bytecode::kConstructWithSpread:
+      return 3;
+    case Bytecode::kCallProperty2:
+      return 4;
+    default:
+      return -1;
+  }
+}
+
+}  // namespace
+
+bool DeoptLoopDetector::GeneralizeFeedback(Handle<FeedbackVector> vector,
+                                           BytecodeOffset bytecode_offset) {
+  Handle<BytecodeArray> bytecode_array(
+      vector->shared_function_info()->GetBytecodeArray(isolate()), isolate());
+  if (!interpreter::BytecodeArrayIterator::IsValidOffset(
+          bytecode_array, bytecode_offset.ToInt())) {
+    return false;
+  }
+  interpreter::BytecodeArrayIterator it(bytecode_array,
+                                        bytecode_offset.ToInt());
+
+  // The slot kind is checked again by FeedbackNexus::Generalize().
+  interpreter::Bytecode bytecode = it.current_bytecode();
+  int slot_operand_index = FeedbackSlotOperandIndex(bytecode);
+  if (slot_operand_index < 0) return false;
+  DCHECK_EQ(interpreter::Bytecodes::GetOperandType(bytecode,
+                                                   slot_operand_index),
+            interpreter::OperandType::kIdx);
+  FeedbackSlot slot = it.GetSlotOperand(slot_operand_index);
+  if (slot.ToInt() >= vector->length()) return false;
+
+  FeedbackNexus nexus(isolate(), vector, slot);
+  if (!nexus.Generalize()) return false;
+  IC::OnFeedbackChanged(isolate(), *vector, slot, "DeoptLoop");
+  return true;
+}
+
+}  // namespace internal
+}  // namespace v8
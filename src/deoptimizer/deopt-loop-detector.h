@@ -0,0 +1,77 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_DEOPTIMIZER_DEOPT_LOOP_DETECTOR_H_
+#define V8_DEOPTIMIZER_DEOPT_LOOP_DETECTOR_H_
+
+#include <unordered_map>
+
+#include "src/base/hashing.h"
+#include "src/deoptimizer/deoptimize-reason.h"
+#include "src/handles/handles.h"
+#include "src/utils/utils.h"
+
+namespace v8 {
+namespace internal {
+
+class FeedbackVector;
+class Isolate;
+class SharedFunctionInfo;
+
+// Detects reoptimize/deopt cycles by counting eager deopts per function,
+// bytecode offset and deopt reason. Sites are identified by script id and
+// function literal id, so the table holds no references into the heap.
+class DeoptLoopDetector {
+ public:
+  explicit DeoptLoopDetector(Isolate* isolate) : isolate_(isolate) {}
+
+  // Records an eager deopt at {bytecode_offset} of {shared}. Returns the
+  // number of deopts recorded for this site and {reason} once it reaches
+  // --deopt-loop-threshold (and starts counting anew), 0 otherwise.
+  int RecordDeopt(Tagged<SharedFunctionInfo> shared,
+                  BytecodeOffset bytecode_offset, DeoptimizeReason reason);
+
+  // Generalizes the feedback consumed by the bytecode at {bytecode_offset}, so
+  // that the next optimization doesn't speculate on it again. Returns true if
+  // the feedback changed.
+  bool GeneralizeFeedback(Handle<FeedbackVector> vector,
+                          BytecodeOffset bytecode_offset);
+
+ private:
+  struct Site {
+    int script_id;
+    int function_literal_id;
+    int bytecode_offset;
+    DeoptimizeReason reason;
+
+    bool operator==(const Site& other) const {
+      return script_id == other.script_id &&
+             function_literal_id == other.function_literal_id &&
+             bytecode_offset == other.bytecode_offset &&
+             reason == other.reason;
+    }
+  };
+
+  struct SiteHash {
+    size_t operator()(const Site& site) const {
+      return base::hash_combine(site.script_id, site.function_literal_id,
+                                site.bytecode_offset,
+                                static_cast<uint8_t>(site.reason));
+    }
+  };
+
+  // Upper bound on the number of tracked sites; the table is flushed when it
+  // is exceeded.
+  static constexpr size_t kMaxTrackedSites = 1024;
+
+  Isolate* isolate() const { return isolate_; }
+
+  Isolate* isolate_;
+  std::unordered_map<Site, int, SiteHash> deopt_counts_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_DEOPTIMIZER_DEOPT_LOOP_DETECTOR_H_
@@ -11,6 +11,7 @@
 #include "src/codegen/register-configuration.h"
 #include "src/codegen/reloc-info.h"
 #include "src/debug/debug.h"
+#include "src/deoptimizer/deopt-loop-detector.h"
 #include "src/deoptimizer/deoptimized-frame-info.h"
 #include "src/deoptimizer/materialized-object-store.h"
 #include "src/deoptimizer/translated-state.h"
@@ -22,6 +23,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
+#include "src/logging/metrics.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/deoptimization-data.h"
 #include "src/objects/js-function-inl.h"
@@ -2950,10 +2952,61 @@ void Deoptimizer::MaterializeHeapObjects() {
     PrintF(file, ", %s\n", DeoptimizeReasonToString(info.deopt_reason));
   }
 
+  if (v8_flags.deopt_loop_detection) DetectDeoptLoop();
+
   isolate_->materialized_object_store()->Remove(
       static_cast<Address>(stack_fp_));
 }
 
+void Deoptimizer::DetectDeoptLoop() {
+  if (deopt_kind_ != DeoptimizeKind::kEager || is_restart_frame() ||
+      deoptimizing_throw_) {
+    return;
+  }
+  Deoptimizer::DeoptInfo info = Deoptimizer::GetDeoptInfo();
+  if (info.deopt_reason == DeoptimizeReason::kOSREarlyExit) return;
+
+  // Only deopts that resume in the interpreter right at the failing bytecode
+  // are attributed to a feedback site.
+  TranslatedFrame& frame = translated_state_.frames().back();
+  if (frame.kind() != TranslatedFrame::kUnoptimizedFunction) return;
+
+  int deopt_count = isolate()->deopt_loop_detector()->RecordDeopt(
+      frame.raw_shared_info(), frame.bytecode_offset(), info.deopt_reason);
+  if (deopt_count == 0) return;
+
+  bool feedback_generalized = false;
+  DirectHandle<Object> closure = frame.begin()->GetValue();
+  if (IsJSFunction(*closure) &&
+      Cast<JSFunction>(*closure)->has_feedback_vector()) {
+    Handle<FeedbackVector> vector(Cast<JSFunction>(*closure)->feedback_vector(),
+                                  isolate());
+    feedback_generalized =
+        isolate()->deopt_loop_detector()->GeneralizeFeedback(
+            vector, frame.bytecode_offset());
+  }
+
+  if (verbose_tracing_enabled()) {
+    FILE* file = trace_scope()->file();
+    PrintF(file, "Deopt loop detected after %d deopts at ", deopt_count);
+    OFStream outstr(file);
+    info.position.Print(outstr, compiled_code_);
+    PrintF(file, ", %s, feedback %s\n",
+           DeoptimizeReasonToString(info.deopt_reason),
+           feedback_generalized ? "generalized" : "unchanged");
+  }
+
+  if (isolate()->metrics_recorder()->HasEmbedderRecorder()) {
+    v8::metrics::DeoptimizationLoopDetected event;
+    event.reason = DeoptimizeReasonToString(info.deopt_reason);
+    event.deopt_count = deopt_count;
+    event.feedback_generalized = feedback_generalized;
+    isolate()->metrics_recorder()->AddMainThreadEvent(
+        event,
+        isolate()->GetOrRegisterRecorderContextId(isolate()->native_context()));
+  }
+}
+
 void Deoptimizer::QueueValueForMaterialization(
     Address output_address, Tagged<Object> obj,
     const TranslatedFrame::iterator& iterator) {
@@ -229,6 +229,10 @@ class Deoptimizer : public Malloced {
 
   static unsigned ComputeIncomingArgumentSize(Tagged<Code> code);
 
+  // Counts repeated eager deopts at the same bytecode and generalizes the
+  // feedback there once --deopt-loop-threshold is reached.
+  void DetectDeoptLoop();
+
   // Tracing.
   bool tracing_enabled() const { return trace_scope_ != nullptr; }
   bool verbose_tracing_enabled() const {
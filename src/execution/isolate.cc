@@ -47,6 +47,7 @@
 #include "src/date/date.h"
 #include "src/debug/debug-frames.h"
 #include "src/debug/debug.h"
+#include "src/deoptimizer/deopt-loop-detector.h"
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/deoptimizer/materialized-object-store.h"
 #include "src/diagnostics/basic-block-profiler.h"
@@ -111,6 +112,7 @@
 #include "src/objects/waiter-queue-node.h"
 #include "src/profiler/heap-profiler.h"
 #include "src/profiler/tracing-cpu-profiler.h"
+#include "src/regexp/regexp-concurrent-compiler.h"
 #include "src/regexp/regexp-stack.h"
 #include "src/roots/roots.h"
 #include "src/roots/static-roots.h"
@@ -4558,6 +4560,9 @@ void Isolate::Deinit() {
   maglev_concurrent_dispatcher_ = nullptr;
 #endif  // V8_ENABLE_MAGLEV
 
+  delete regexp_concurrent_compiler_;
+  regexp_concurrent_compiler_ = nullptr;
+
   if (lazy_compile_dispatcher_) {
     lazy_compile_dispatcher_->AbortAll();
     lazy_compile_dispatcher_.reset();
@@ -4774,6 +4779,9 @@ Isolate::~Isolate() {
   delete materialized_object_store_;
   materialized_object_store_ = nullptr;
 
+  delete deopt_loop_detector_;
+  deopt_loop_detector_ = nullptr;
+
   delete v8_file_logger_;
   v8_file_logger_ = nullptr;
 
@@ -5566,7 +5574,9 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
   store_stub_cache_ = new StubCache(this);
   define_own_stub_cache_ = new StubCache(this);
   materialized_object_store_ = new MaterializedObjectStore(this);
+  deopt_loop_detector_ = new DeoptLoopDetector(this);
   regexp_stack_ = new RegExpStack();
+  regexp_concurrent_compiler_ = new RegExpConcurrentCompiler(this);
   isolate_data()->set_regexp_static_result_offsets_vector(
       jsregexp_static_offsets_vector());
   date_cache_ = new DateCache();
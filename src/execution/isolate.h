@@ -124,6 +124,7 @@ class CompilationCache;
 class CompilationStatistics;
 class Counters;
 class Debug;
+class DeoptLoopDetector;
 class Deoptimizer;
 class DescriptorLookupCache;
 class EmbeddedFileWriterInterface;
@@ -145,6 +146,7 @@ class OptimizingCompileTaskExecutor;
 class PersistentHandles;
 class PersistentHandlesList;
 class ReadOnlyArtifacts;
+class RegExpConcurrentCompiler;
 class RegExpStack;
 class RootVisitor;
 class SetupIsolateDelegate;
@@ -532,6 +534,7 @@ using DebugObjectCache = std::vector<Handle<HeapObject>>;
   V(WasmJSPIEnabledCallback, wasm_jspi_enabled_callback, nullptr)           \
   V(IsJSApiWrapperNativeErrorCallback,                                      \
     is_js_api_wrapper_native_error_callback, nullptr)                       \
+  V(TieringPolicyCallback, tiering_policy_callback, nullptr)                 \
   /* State for Relocatable. */                                              \
   V(Relocatable*, relocatable_top, nullptr)                                 \
   V(DebugObjectCache*, string_stream_debug_object_cache, nullptr)           \
@@ -1391,6 +1394,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return materialized_object_store_;
   }
 
+  DeoptLoopDetector* deopt_loop_detector() const {
+    return deopt_loop_detector_;
+  }
+
   DescriptorLookupCache* descriptor_lookup_cache() const {
     return descriptor_lookup_cache_;
   }
@@ -1459,6 +1466,9 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   }
 
   RegExpStack* regexp_stack() const { return regexp_stack_; }
+  RegExpConcurrentCompiler* regexp_concurrent_compiler() const {
+    return regexp_concurrent_compiler_;
+  }
 
   // Either points to jsregexp_static_offsets_vector, or nullptr if the static
   // vector is in use.
@@ -2600,6 +2610,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   Deoptimizer* current_deoptimizer_ = nullptr;
   bool deoptimizer_lazy_throw_ = false;
   MaterializedObjectStore* materialized_object_store_ = nullptr;
+  DeoptLoopDetector* deopt_loop_detector_ = nullptr;
   bool capture_stack_trace_for_uncaught_exceptions_ = false;
   int stack_trace_for_uncaught_exceptions_frame_limit_ = 0;
   StackTrace::StackTraceOptions stack_trace_for_uncaught_exceptions_options_ =
@@ -2628,6 +2639,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
       regexp_macro_assembler_canonicalize_;
 #endif  // !V8_INTL_SUPPORT
   RegExpStack* regexp_stack_ = nullptr;
+  RegExpConcurrentCompiler* regexp_concurrent_compiler_ = nullptr;
   std::vector<int> regexp_indices_;
   // Necessary in order to avoid memory leaks in the presence of
   // TerminateExecution exceptions.
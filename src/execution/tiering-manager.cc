@@ -13,12 +13,14 @@
 #include "src/codegen/compiler.h"
 #include "src/codegen/pending-optimization-table.h"
 #include "src/common/globals.h"
+#include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 #include "src/diagnostics/code-tracer.h"
 #include "src/execution/execution.h"
 #include "src/execution/frames-inl.h"
 #include "src/flags/flags.h"
 #include "src/handles/global-handles.h"
 #include "src/init/bootstrapper.h"
+#include "src/init/v8.h"
 #include "src/interpreter/interpreter.h"
 #include "src/objects/code-kind.h"
 #include "src/objects/code.h"
@@ -28,6 +30,10 @@
 #include "src/baseline/baseline-batch-compiler.h"
 #endif  // V8_ENABLE_SPARKPLUG
 
+#ifdef V8_ENABLE_MAGLEV
+#include "src/maglev/maglev-concurrent-dispatcher.h"
+#endif  // V8_ENABLE_MAGLEV
+
 namespace v8 {
 namespace internal {
 
@@ -115,6 +121,17 @@ void TraceHeuristicOptimizationDisallowed(Tagged<JSFunction> function) {
   }
 }
 
+void TraceTieringPolicyDelay(Tagged<JSFunction> function,
+                             const TieringCandidate& candidate) {
+  if (v8_flags.trace_opt_verbose) {
+    PrintF(
+        "[not marking function %s for optimization: delayed by tiering policy "
+        "(invocations: %d, compile queue: %zu, workers: %d)]\n",
+        function->DebugNameCStr().get(), candidate.invocation_count,
+        candidate.compile_queue_length, candidate.worker_thread_count);
+  }
+}
+
 void TraceRecompile(Isolate* isolate, Tagged<JSFunction> function,
                     OptimizationDecision d) {
   if (v8_flags.trace_opt) {
@@ -389,9 +406,87 @@ void TieringManager::MaybeOptimizeFrame(Tagged<JSFunction> function,
     d.concurrency_mode = ConcurrencyMode::kSynchronous;
   }
 
+  if (d.should_optimize()) d = ApplyTieringPolicy(function, d);
   if (d.should_optimize()) Optimize(function, d);
 }
 
+namespace {
+
+// The built-in adaptive policy: while there are more queued compile jobs than
+// the workers can take, further requests would only wait in the queue, so
+// delay them unless the function has been waiting for a long time already.
+TieringDecision AdaptiveTieringDecision(const TieringCandidate& candidate) {
+  if (!v8_flags.adaptive_tiering) return TieringDecision::kOptimize;
+  const size_t max_backlog =
+      static_cast<size_t>(candidate.worker_thread_count) *
+      std::max(1, v8_flags.adaptive_tiering_backlog_per_worker);
+  if (candidate.compile_queue_length < max_backlog) {
+    return TieringDecision::kOptimize;
+  }
+  // Functions stuck in long-running loops get OSR'd instead.
+  if (candidate.osr_urgency > 0) return TieringDecision::kOptimize;
+  const int tier_invocation_count =
+      candidate.tier == OptimizationTier::kMaglev
+          ? v8_flags.invocation_count_for_maglev
+          : v8_flags.invocation_count_for_turbofan;
+  const int64_t max_delay_invocation_count =
+      static_cast<int64_t>(tier_invocation_count) *
+      std::max(1, v8_flags.adaptive_tiering_max_delay_factor);
+  if (candidate.invocation_count >= max_delay_invocation_count) {
+    return TieringDecision::kOptimize;
+  }
+  return TieringDecision::kDelay;
+}
+
+}  // namespace
+
+size_t TieringManager::CompileQueueLength(CodeKind code_kind) {
+  if (code_kind == CodeKind::MAGLEV) {
+#ifdef V8_ENABLE_MAGLEV
+    maglev::MaglevConcurrentDispatcher* dispatcher =
+        isolate_->maglev_concurrent_dispatcher();
+    if (dispatcher->is_enabled()) return dispatcher->QueueLength();
+#endif  // V8_ENABLE_MAGLEV
+    return 0;
+  }
+  if (!isolate_->concurrent_recompilation_enabled()) return 0;
+  return isolate_->optimizing_compile_dispatcher()->InputQueueLength();
+}
+
+OptimizationDecision TieringManager::ApplyTieringPolicy(
+    Tagged<JSFunction> function, OptimizationDecision d) {
+  DCHECK(d.should_optimize());
+  TieringPolicyCallback callback = isolate_->tiering_policy_callback();
+  if (V8_LIKELY(callback == nullptr && !v8_flags.adaptive_tiering)) return d;
+
+  Tagged<FeedbackVector> vector = function->feedback_vector();
+  TieringCandidate candidate;
+  candidate.tier = d.code_kind == CodeKind::MAGLEV
+                       ? OptimizationTier::kMaglev
+                       : OptimizationTier::kTurbofan;
+  candidate.bytecode_size =
+      function->shared()->GetBytecodeArray(isolate_)->length();
+  candidate.invocation_count = vector->invocation_count();
+  candidate.osr_urgency = vector->osr_urgency();
+  candidate.was_deoptimized = vector->was_once_deoptimized();
+  candidate.compile_queue_length = CompileQueueLength(d.code_kind);
+  candidate.worker_thread_count =
+      std::max(1, V8::GetCurrentPlatform()->NumberOfWorkerThreads());
+
+  TieringDecision decision = TieringDecision::kDefault;
+  if (callback != nullptr) {
+    decision = callback(reinterpret_cast<v8::Isolate*>(isolate_), candidate);
+  }
+  if (decision == TieringDecision::kDefault) {
+    decision = AdaptiveTieringDecision(candidate);
+  }
+  if (decision == TieringDecision::kDelay) {
+    TraceTieringPolicyDelay(function, candidate);
+    return OptimizationDecision::DoNotOptimize();
+  }
+  return d;
+}
+
 OptimizationDecision TieringManager::ShouldOptimize(
     Tagged<FeedbackVector> feedback_vector, CodeKind current_code_kind) {
   Tagged<SharedFunctionInfo> shared = feedback_vector->shared_function_info();
@@ -53,6 +53,11 @@ class TieringManager {
   // tick.
   OptimizationDecision ShouldOptimize(Tagged<FeedbackVector> feedback_vector,
                                       CodeKind code_kind);
+  // Lets the embedder's TieringPolicyCallback, or the built-in adaptive
+  // policy, delay an optimization that the heuristics above decided on.
+  OptimizationDecision ApplyTieringPolicy(Tagged<JSFunction> function,
+                                          OptimizationDecision decision);
+  size_t CompileQueueLength(CodeKind code_kind);
   void Optimize(Tagged<JSFunction> function, OptimizationDecision decision);
   void Baseline(Tagged<JSFunction> function, OptimizationReason reason);
 
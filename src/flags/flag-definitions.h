@@ -756,6 +756,12 @@ DEFINE_BOOL(empty_context_extension_dep, true,
             "non-empty context extensions")
 
 DEFINE_BOOL(json_stringify_fast_path, true, "Enable JSON.stringify fast-path")
+DEFINE_UINT(json_parse_pretenure_threshold, 1 * MB,
+            "allocate the result of JSON.parse in old space if the input has "
+            "at least this many characters (0 to disable)")
+DEFINE_BOOL(json_parse_shape_cache, true,
+            "use the maps of previously parsed objects with the same first "
+            "key as feedback in JSON.parse")
 
 // TODO(jgruber): Remove this flag.
 DEFINE_BOOL(cache_property_key_string_adds, true,
@@ -1016,6 +1022,16 @@ DEFINE_INT(minimum_invocations_after_ic_update, 500,
            "How long to minimally wait after IC update before tier up")
 DEFINE_INT(minimum_invocations_before_optimization, 2,
            "Minimum number of invocations we need before non-OSR optimization")
+DEFINE_BOOL(adaptive_tiering, false,
+            "delay tier-up while the background compile queues are backed up "
+            "relative to the number of worker threads")
+DEFINE_INT(adaptive_tiering_backlog_per_worker, 2,
+           "number of queued compile jobs per worker thread at which "
+           "--adaptive-tiering starts delaying tier-up")
+DEFINE_INT(adaptive_tiering_max_delay_factor, 4,
+           "--adaptive-tiering stops delaying a function once its invocation "
+           "count reaches this multiple of the tier's invocation count "
+           "(at least 1)")
 
 // Tiering: JIT fuzzing.
 //
@@ -1142,10 +1158,15 @@ DEFINE_UINT(
     "max number of threads that concurrent Sparkplug can use (0 for unbounded)")
 DEFINE_BOOL(concurrent_sparkplug_high_priority_threads, false,
             "use high priority compiler threads for concurrent Sparkplug")
+DEFINE_BOOL(concurrent_sparkplug_off_thread_install, false,
+            "install concurrent Sparkplug code from the background thread")
 #else
 DEFINE_BOOL(baseline_batch_compilation, false, "batch compile Sparkplug code")
 DEFINE_BOOL_READONLY(concurrent_sparkplug, false,
                      "compile Sparkplug code in a background thread")
+DEFINE_BOOL_READONLY(
+    concurrent_sparkplug_off_thread_install, false,
+    "install concurrent Sparkplug code from the background thread")
 #endif
 DEFINE_STRING(sparkplug_filter, "*", "filter for Sparkplug baseline compiler")
 DEFINE_BOOL(sparkplug_needs_short_builtins, false,
@@ -1485,6 +1506,12 @@ DEFINE_STRING(
 
 DEFINE_BOOL(turbo_verify_allocation, DEBUG_BOOL,
             "verify register allocation in TurboFan")
+DEFINE_BOOL(turbo_concurrent_register_allocation, false,
+            "allocate FP and SIMD registers on a helper thread, concurrently "
+            "with the general registers, for large functions")
+DEFINE_INT(turbo_concurrent_register_allocation_min_instructions, 10000,
+           "minimum number of instructions for which registers are allocated "
+           "concurrently")
 DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "TurboFan loop peeling")
@@ -1569,6 +1596,9 @@ DEFINE_BOOL(turboshaft_enable_debug_features, false,
 
 DEFINE_BOOL(turboshaft_wasm_load_elimination, true,
             "enable Turboshaft's WasmLoadElimination")
+DEFINE_BOOL(turboshaft_wasm_escape_analysis, false,
+            "enable Turboshaft's WasmEscapeAnalysis, which scalar-replaces "
+            "non-escaping Wasm structs")
 
 DEFINE_EXPERIMENTAL_FEATURE(
     turboshaft_wasm_in_js_inlining,
@@ -1677,6 +1707,12 @@ DEFINE_VALUE_IMPLICATION(optimize_for_size, max_semi_space_size, size_t{1})
 
 DEFINE_BOOL(reopt_after_lazy_deopts, true,
             "Immediately re-optimize code after some lazy deopts")
+DEFINE_BOOL(deopt_loop_detection, false,
+            "generalize the feedback at bytecodes that repeatedly cause eager "
+            "deopts for the same reason")
+DEFINE_INT(deopt_loop_threshold, 3,
+           "number of eager deopts for the same reason at the same bytecode "
+           "after which its feedback is generalized")
 
 // Flags for WebAssembly.
 #if V8_ENABLE_WEBASSEMBLY
@@ -1700,6 +1736,13 @@ DEFINE_DEBUG_BOOL(trace_wasm_serialization, false,
 DEFINE_BOOL(wasm_async_compilation, true,
             "enable actual asynchronous compilation for WebAssembly.compile")
 DEFINE_NEG_IMPLICATION(single_threaded, wasm_async_compilation)
+DEFINE_BOOL(wasm_parallel_data_segments, true,
+            "copy large active data segments into memory on multiple threads "
+            "during instantiation")
+DEFINE_NEG_IMPLICATION(single_threaded, wasm_parallel_data_segments)
+DEFINE_SIZE_T(wasm_parallel_data_segments_min_kb, 16 * 1024,
+              "minimum total size of active data segments (in KB) for copying "
+              "them on multiple threads")
 DEFINE_BOOL(wasm_test_streaming, false,
             "use streaming compilation instead of async compilation for tests")
 DEFINE_BOOL(wasm_native_module_cache, true, "enable the native module cache")
@@ -1763,6 +1806,9 @@ DEFINE_BOOL(liftoff, true,
             "enable Liftoff, the baseline compiler for WebAssembly")
 DEFINE_BOOL(liftoff_only, false,
             "disallow TurboFan compilation for WebAssembly (for testing)")
+DEFINE_INT(wasm_liftoff_loop_register_locals, 4,
+           "maximum number of locals Liftoff keeps in registers when entering "
+           "an innermost loop without calls (0 to spill all locals)")
 DEFINE_IMPLICATION(liftoff_only, liftoff)
 DEFINE_NEG_IMPLICATION(liftoff_only, wasm_tier_up)
 DEFINE_NEG_IMPLICATION(liftoff_only, wasm_dynamic_tiering)
@@ -1795,6 +1841,9 @@ DEFINE_NEG_IMPLICATION(experimental_wasm_pgo_to_file, single_threaded)
 DEFINE_BOOL(
     experimental_wasm_pgo_from_file, false,
     "experimental: read and use Wasm PGO data from a local file (for testing)")
+DEFINE_STRING(wasm_native_module_file_cache, nullptr,
+              "experimental: directory for a cache of serialized Wasm modules "
+              "that is shared between processes")
 
 DEFINE_BOOL(validate_asm, true,
             "validate asm.js modules and translate them to Wasm")
@@ -1962,6 +2011,9 @@ DEFINE_BOOL(wasm_code_gc, true, "enable garbage collection of wasm code")
 DEFINE_BOOL(trace_wasm_code_gc, false, "trace garbage collection of wasm code")
 DEFINE_BOOL(stress_wasm_code_gc, false,
             "stress test garbage collection of wasm code")
+DEFINE_BOOL(wasm_reuse_freed_code_space, false,
+            "allocate new wasm code in the space of code freed by code GC "
+            "(e.g. replaced Liftoff code) before using fresh code space")
 DEFINE_INT(wasm_max_initial_code_space_reservation, 0,
            "maximum size of the initial wasm code space reservation (in MB)")
 DEFINE_BOOL(stress_wasm_memory_moving, false,
@@ -2022,6 +2074,12 @@ DEFINE_BOOL_READONLY(wasm_memory64_trap_handling, false,
                      "Use trap handling for Wasm memory64 bounds checks (not "
                      "supported for this architecture)")
 #endif  // V8_TARGET_ARCH_ARM64 || V8_TARGET_ARCH_X64
+DEFINE_BOOL(wasm_memory64_clamp_bounds_checks, false,
+            "clamp out-of-bounds memory64 indexes into a guard region behind "
+            "the memory reservation instead of branching to a trap; the trap "
+            "handler then reports the faulting access")
+DEFINE_NEG_NEG_IMPLICATION(wasm_memory64_trap_handling,
+                           wasm_memory64_clamp_bounds_checks)
 
 #ifdef V8_ENABLE_DRUMBRAKE
 // DrumBrake flags.
@@ -2669,6 +2727,12 @@ DEFINE_EXPERIMENTAL_FEATURE(
     parallel_compile_tasks_for_lazy,
     "spawn parallel compile tasks for all lazily compiled functions")
 DEFINE_IMPLICATION(parallel_compile_tasks_for_lazy, lazy_compile_dispatcher)
+DEFINE_EXPERIMENTAL_FEATURE(
+    parallel_compile_tasks_for_compile_hints,
+    "spawn parallel compile tasks for functions that are eagerly compiled "
+    "because of compile hints")
+DEFINE_IMPLICATION(parallel_compile_tasks_for_compile_hints,
+                   lazy_compile_dispatcher)
 
 // cpu-profiler.cc
 DEFINE_INT(cpu_profiler_sampling_interval, 1000,
@@ -2922,9 +2986,20 @@ DEFINE_NEG_IMPLICATION(regexp_interpret_all, regexp_tier_up)
 DEFINE_INT(regexp_tier_up_ticks, 1,
            "set the number of executions for the regexp interpreter before "
            "tiering-up to the compiler")
+DEFINE_BOOL(regexp_concurrent_tier_up, false,
+            "run the front end of the regexp tier-up compilation on a "
+            "background thread while the interpreter keeps running")
+DEFINE_NEG_IMPLICATION(single_threaded, regexp_concurrent_tier_up)
+DEFINE_BOOL(regexp_shared_bytecode_cache, true,
+            "share regexp bytecode between the isolates of an isolate group")
+DEFINE_SIZE_T(regexp_shared_bytecode_cache_size, 1024,
+              "maximum size of the shared regexp bytecode cache (in KB)")
 DEFINE_BOOL(regexp_peephole_optimization, REGEXP_PEEPHOLE_OPTIMIZATION_BOOL,
             "enable peephole optimization for regexp bytecode")
 DEFINE_BOOL(regexp_results_cache, true, "enable the regexp results cache")
+DEFINE_BOOL(regexp_required_literals, true,
+            "before running regexp jit code, search the subject for literals "
+            "that every match must contain")
 DEFINE_BOOL(trace_regexp_peephole_optimization, false,
             "trace regexp bytecode peephole optimization")
 DEFINE_BOOL(trace_regexp_bytecodes, false, "trace regexp bytecode execution")
@@ -2947,6 +3022,12 @@ DEFINE_IMPLICATION(experimental_regexp_engine_capture_group_opt,
 DEFINE_UINT64(experimental_regexp_engine_capture_group_opt_max_memory_usage,
               1024,
               "maximum memory usage in MB allowed for experimental engine")
+DEFINE_BOOL(experimental_regexp_engine_lazy_dfa, true,
+            "use a lazily built DFA to find matches in the experimental "
+            "regexp engine before computing captures with the NFA")
+DEFINE_SIZE_T(experimental_regexp_engine_lazy_dfa_max_memory, 1024,
+              "maximum memory usage in KB of the lazy DFA states of a single "
+              "experimental regexp execution")
 DEFINE_BOOL(trace_experimental_regexp_engine, false,
             "trace execution of experimental regexp engine")
 
@@ -3489,6 +3570,7 @@ DEFINE_NEG_IMPLICATION(predictable, stress_concurrent_inlining)
 DEFINE_NEG_IMPLICATION(predictable, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_compile_hints)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(predictable, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(predictable, maglev_build_code_on_background)
@@ -3519,11 +3601,14 @@ DEFINE_BOOL(single_threaded, false, "disable the use of background tasks")
 DEFINE_IMPLICATION(single_threaded, single_threaded_gc)
 DEFINE_NEG_IMPLICATION(single_threaded, concurrent_recompilation)
 DEFINE_NEG_IMPLICATION(single_threaded, concurrent_builtin_generation)
+DEFINE_NEG_IMPLICATION(single_threaded, turbo_concurrent_register_allocation)
 DEFINE_NEG_IMPLICATION(single_threaded, stress_concurrent_inlining)
 DEFINE_NEG_IMPLICATION(single_threaded, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(single_threaded,
                        parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(single_threaded,
+                       parallel_compile_tasks_for_compile_hints)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_build_code_on_background)
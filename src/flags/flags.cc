@@ -1158,6 +1158,7 @@ void FlagList::ResolveContradictionsWhenFuzzing() {
 
       // https://crbug.com/371061101
       RESET_WHEN_FUZZING(parallel_compile_tasks_for_lazy),
+      RESET_WHEN_FUZZING(parallel_compile_tasks_for_compile_hints),
 
       // https://crbug.com/366671002
       RESET_WHEN_FUZZING(stress_snapshot),
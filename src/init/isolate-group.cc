@@ -17,6 +17,7 @@
 #include "src/heap/read-only-heap.h"
 #include "src/heap/read-only-spaces.h"
 #include "src/heap/trusted-range.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "src/sandbox/code-pointer-table-inl.h"
 #include "src/sandbox/sandbox.h"
 #include "src/utils/memcopy.h"
@@ -146,6 +147,8 @@ void IsolateGroup::Initialize(bool process_wide, Sandbox* sandbox) {
   code_pointer_table()->Initialize();
   optimizing_compile_task_executor_ =
       std::make_unique<OptimizingCompileTaskExecutor>();
+  regexp_bytecode_cache_ = std::make_unique<RegExpBytecodeCache>(
+      v8_flags.regexp_shared_bytecode_cache_size * KB);
   page_pool_ = std::make_unique<PagePool>();
 
 #ifdef V8_ENABLE_LEAPTIERING
@@ -168,6 +171,8 @@ void IsolateGroup::Initialize(bool process_wide) {
   trusted_pointer_compression_cage_ = &reservation_;
   optimizing_compile_task_executor_ =
       std::make_unique<OptimizingCompileTaskExecutor>();
+  regexp_bytecode_cache_ = std::make_unique<RegExpBytecodeCache>(
+      v8_flags.regexp_shared_bytecode_cache_size * KB);
   page_pool_ = std::make_unique<PagePool>();
 #ifdef V8_ENABLE_LEAPTIERING
   js_dispatch_table()->Initialize();
@@ -179,6 +184,8 @@ void IsolateGroup::Initialize(bool process_wide) {
   page_allocator_ = GetPlatformPageAllocator();
   optimizing_compile_task_executor_ =
       std::make_unique<OptimizingCompileTaskExecutor>();
+  regexp_bytecode_cache_ = std::make_unique<RegExpBytecodeCache>(
+      v8_flags.regexp_shared_bytecode_cache_size * KB);
   page_pool_ = std::make_unique<PagePool>();
 #ifdef V8_ENABLE_LEAPTIERING
   js_dispatch_table()->Initialize();
@@ -91,6 +91,7 @@ class Isolate;
 class OptimizingCompileTaskExecutor;
 class ReadOnlyHeap;
 class ReadOnlyArtifacts;
+class RegExpBytecodeCache;
 class SnapshotData;
 
 // An IsolateGroup allows an API user to control which isolates get allocated
@@ -198,6 +199,11 @@ class V8_EXPORT_PRIVATE IsolateGroup final {
 
   OptimizingCompileTaskExecutor* optimizing_compile_task_executor();
 
+  // Irregexp bytecode shared by the isolates of this group.
+  RegExpBytecodeCache* regexp_bytecode_cache() {
+    return regexp_bytecode_cache_.get();
+  }
+
   ReadOnlyHeap* shared_read_only_heap() const { return shared_read_only_heap_; }
   void set_shared_read_only_heap(ReadOnlyHeap* heap) {
     shared_read_only_heap_ = heap;
@@ -332,6 +338,7 @@ class V8_EXPORT_PRIVATE IsolateGroup final {
   Isolate* shared_space_isolate_ = nullptr;
   std::unique_ptr<OptimizingCompileTaskExecutor>
       optimizing_compile_task_executor_;
+  std::unique_ptr<RegExpBytecodeCache> regexp_bytecode_cache_;
 
   // Set of isolates currently in the IsolateGroup. Guarded by mutex_.
   absl::flat_hash_set<Isolate*> isolates_;
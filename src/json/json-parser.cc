@@ -4,8 +4,11 @@
 
 #include "src/json/json-parser.h"
 
+#include <algorithm>
 #include <optional>
+#include <vector>
 
+#include "src/base/hashing.h"
 #include "src/base/small-vector.h"
 #include "src/base/strings.h"
 #include "src/builtins/builtins.h"
@@ -15,6 +18,7 @@
 #include "src/debug/debug.h"
 #include "src/execution/frames-inl.h"
 #include "src/heap/factory.h"
+#include "src/logging/counters.h"
 #include "src/numbers/conversions.h"
 #include "src/numbers/hash-seed-inl.h"
 #include "src/objects/elements-kind.h"
@@ -332,6 +336,11 @@ JsonParser<Char>::JsonParser(Isolate* isolate, Handle<String> source)
   }
   cursor_ = chars_ + start;
   end_ = cursor_ + length;
+
+  if (v8_flags.json_parse_pretenure_threshold > 0 &&
+      length >= v8_flags.json_parse_pretenure_threshold) {
+    allocation_ = AllocationType::kOld;
+  }
 }
 
 template <typename Char>
@@ -537,6 +546,10 @@ MaybeHandle<Object> JsonParser<Char>::ParseJson(DirectHandle<Object> reviver) {
   if (V8_UNLIKELY(should_track_json_source)) {
     ASSIGN_RETURN_ON_EXCEPTION(isolate(), result, ParseJsonValue<true>());
   } else {
+    if (shape_cache_.is_null() && v8_flags.json_parse_shape_cache &&
+        original_source_->length() >= kMinShapeCacheSourceLength) {
+      shape_cache_ = factory()->NewFixedArray(kShapeCacheSize);
+    }
     ASSIGN_RETURN_ON_EXCEPTION(isolate(), result, ParseJsonValueRecursive());
   }
 
@@ -640,10 +653,11 @@ class FoldedMutableHeapNumberAllocation {
   // padding fillers between heap numbers.
   static_assert(!USE_ALLOCATION_ALIGNMENT_HEAP_NUMBER_BOOL);
 
-  FoldedMutableHeapNumberAllocation(Isolate* isolate, int count) {
+  FoldedMutableHeapNumberAllocation(Isolate* isolate, int count,
+                                    AllocationType allocation) {
     if (count == 0) return;
     int size = count * sizeof(HeapNumber);
-    raw_bytes_ = isolate->factory()->NewByteArray(size);
+    raw_bytes_ = isolate->factory()->NewByteArray(size, allocation);
   }
 
   Handle<ByteArray> raw_bytes() const { return raw_bytes_; }
@@ -744,11 +758,13 @@ class JSDataObjectBuilder {
   JSDataObjectBuilder(Isolate* isolate, ElementsKind elements_kind,
                       int expected_named_properties,
                       DirectHandle<Map> expected_final_map,
-                      HeapNumberMode heap_number_mode)
+                      HeapNumberMode heap_number_mode,
+                      AllocationType allocation = AllocationType::kYoung)
       : isolate_(isolate),
         elements_kind_(elements_kind),
         expected_property_count_(expected_named_properties),
         heap_number_mode_(heap_number_mode),
+        allocation_(allocation),
         expected_final_map_(expected_final_map) {
     if (!TryInitializeMapFromExpectedFinalMap()) {
       InitializeMapFromZero();
@@ -905,7 +921,7 @@ class JSDataObjectBuilder {
       DCHECK_EQ(current_property_index_, 0);
 
       Handle<JSObject> object = isolate_->factory()->NewSlowJSObjectFromMap(
-          map_, expected_property_count_);
+          map_, expected_property_count_, allocation_);
       object->set_elements(*elements);
       object_ = object;
       return;
@@ -923,12 +939,13 @@ class JSDataObjectBuilder {
     // object -- this ensures that there is no allocation between the object
     // allocation and its initial fields being initialised, where the verifier
     // would see invalid double field state.
-    FoldedMutableHeapNumberAllocation hn_allocation(isolate_,
-                                                    extra_heap_numbers_needed_);
+    FoldedMutableHeapNumberAllocation hn_allocation(
+        isolate_, extra_heap_numbers_needed_, allocation_);
 
     // Allocate the object then immediately start a no_gc scope -- again, this
     // is so the verifier doesn't see invalid double field state.
-    Handle<JSObject> object = isolate_->factory()->NewJSObjectFromMap(map_);
+    Handle<JSObject> object =
+        isolate_->factory()->NewJSObjectFromMap(map_, allocation_);
     DisallowGarbageCollection no_gc;
     Tagged<JSObject> raw_object = *object;
 
@@ -1196,6 +1213,7 @@ class JSDataObjectBuilder {
   ElementsKind elements_kind_;
   int expected_property_count_;
   HeapNumberMode heap_number_mode_;
+  AllocationType allocation_;
 
   DirectHandle<Map> map_;
   int current_property_index_ = 0;
@@ -1305,7 +1323,7 @@ Handle<JSObject> JsonParser<Char>::BuildJsonObject(const JsonContinuation& cont,
     // Store as dictionary elements if that would use less memory.
     if (ShouldConvertToSlowElements(cont.elements, cont.max_index + 1)) {
       Handle<NumberDictionary> elms =
-          NumberDictionary::New(isolate_, cont.elements);
+          NumberDictionary::New(isolate_, cont.elements, allocation_);
       for (int i = 0; i < length; i++) {
         const JsonProperty& property = property_stack_[start + i];
         if (!property.string.is_index()) continue;
@@ -1319,7 +1337,7 @@ Handle<JSObject> JsonParser<Char>::BuildJsonObject(const JsonContinuation& cont,
       elements = elms;
     } else {
       Handle<FixedArray> elms =
-          factory()->NewFixedArrayWithHoles(cont.max_index + 1);
+          factory()->NewFixedArrayWithHoles(cont.max_index + 1, allocation_);
       DisallowGarbageCollection no_gc;
       Tagged<FixedArray> raw_elements = *elms;
       WriteBarrierMode mode = raw_elements->GetWriteBarrierMode(no_gc);
@@ -1345,7 +1363,8 @@ Handle<JSObject> JsonParser<Char>::BuildJsonObject(const JsonContinuation& cont,
       isolate_, elements_kind, named_length, feedback,
       should_track_json_source
           ? JSDataObjectBuilder::kNormalHeapNumbers
-          : JSDataObjectBuilder::kHeapNumbersGuaranteedUniquelyOwned);
+          : JSDataObjectBuilder::kHeapNumbersGuaranteedUniquelyOwned,
+      allocation_);
 
   NamedPropertyIterator it(*this, property_stack_.begin() + start,
                            property_stack_.end());
@@ -1370,7 +1389,9 @@ Handle<Object> JsonParser<Char>::BuildJsonArray(size_t start) {
     }
   }
 
-  Handle<JSArray> array = factory()->NewJSArray(kind, length, length);
+  Handle<JSArray> array = factory()->NewJSArray(
+      kind, length, length,
+      ArrayStorageAllocationMode::DONT_INITIALIZE_ARRAY_ELEMENTS, allocation_);
   if (kind == PACKED_DOUBLE_ELEMENTS) {
     DisallowGarbageCollection no_gc;
     Tagged<FixedDoubleArray> elements =
@@ -1483,6 +1504,154 @@ bool JsonParser<Char>::FastKeyMatch(const uint8_t* key_chars,
          CompareCharsEqual(key_chars, cursor_, key_length);
 }
 
+namespace {
+
+// Keys are hashed by code unit, so that one-byte keys of a shape hint find
+// the same slot as two-byte sources.
+template <typename KeyChar>
+int ShapeCacheSlot(base::Vector<const KeyChar> key, int cache_size) {
+  base::Hasher hasher;
+  for (KeyChar c : key) hasher.Add(static_cast<base::uc16>(c));
+  return static_cast<int>(hasher.hash() % cache_size);
+}
+
+}  // namespace
+
+template <typename Char>
+Handle<Map> JsonParser<Char>::LookupShapeCache(int* slot) {
+  DCHECK(!shape_cache_.is_null());
+  *slot = -1;
+  if (peek() != JsonToken::STRING) return {};
+  const Char* key_start = cursor_ + 1;
+  const Char* limit =
+      key_start + std::min<size_t>(remaining_chars() - 1,
+                                   kMaxShapeCacheKeyLength);
+  const Char* key_end = std::find_if(
+      key_start, limit, [](Char c) { return c == '"' || c == '\\'; });
+  // Keys that are long or contain escapes aren't cached.
+  if (key_end == limit || *key_end != '"') return {};
+  base::Vector<const Char> key(key_start, key_end - key_start);
+  *slot = ShapeCacheSlot(key, kShapeCacheSize);
+
+  DisallowGarbageCollection no_gc;
+  Tagged<Object> entry = shape_cache_->get(*slot);
+  if (!IsMap(entry)) return {};
+  Tagged<Map> map = Cast<Map>(entry);
+  // Don't consume feedback from maps that are detached from the transition
+  // tree, like for array siblings.
+  if (map->IsDetached(isolate_)) return {};
+  DCHECK_GT(map->NumberOfOwnDescriptors(), 0);
+  Tagged<Name> first_key =
+      map->instance_descriptors(isolate_)->GetKey(InternalIndex(0));
+  if (!IsString(first_key) || !Cast<String>(first_key)->IsEqualTo(key)) {
+    return {};
+  }
+  isolate_->counters()->json_parse_shape_cache_hits()->Increment();
+  return handle(map, isolate_);
+}
+
+template <typename Char>
+void JsonParser<Char>::UpdateShapeCache(int slot, Tagged<Map> map) {
+  DCHECK(!shape_cache_.is_null());
+  if (map->is_dictionary_map() || map->NumberOfOwnDescriptors() == 0 ||
+      map->IsDetached(isolate_)) {
+    return;
+  }
+  shape_cache_->set(slot, map);
+}
+
+template <typename Char>
+void JsonParser<Char>::SeedShapeCache(DirectHandle<JSReceiver> hint) {
+  DCHECK(!shape_cache_.is_null());
+  HandleScope scope(isolate_);
+  // The hint is walked depth-first, visiting at most kMaxShapeHintNodes
+  // objects and arrays. The subobjects of a map are only visited once, which
+  // also stops at cycles.
+  std::vector<std::pair<Handle<Object>, int>> worklist;
+  std::vector<Handle<Map>> seeded_maps;
+  worklist.emplace_back(indirect_handle(hint, isolate_), 0);
+  int visited_nodes = 0;
+  while (!worklist.empty() && visited_nodes < kMaxShapeHintNodes) {
+    auto [node, depth] = worklist.back();
+    worklist.pop_back();
+    if (depth > kMaxShapeHintDepth) continue;
+    if (IsJSArray(*node)) {
+      ++visited_nodes;
+      // The first element stands for all elements of the array.
+      Tagged<JSArray> array = Cast<JSArray>(*node);
+      if (!IsObjectElementsKind(array->GetElementsKind())) continue;
+      Tagged<FixedArray> elements = Cast<FixedArray>(array->elements());
+      if (elements->length() == 0) continue;
+      worklist.emplace_back(handle(elements->get(0), isolate_), depth + 1);
+      continue;
+    }
+    if (!IsJSObject(*node)) continue;
+    ++visited_nodes;
+    Handle<JSObject> object = Cast<JSObject>(node);
+    Handle<Map> map(object->map(), isolate_);
+    if (map->is_deprecated()) map = Map::Update(isolate_, map);
+    if (!IsValidShapeHint(*map)) continue;
+    if (std::any_of(seeded_maps.begin(), seeded_maps.end(),
+                    [&](Handle<Map> seeded) { return *seeded == *map; })) {
+      continue;
+    }
+    seeded_maps.push_back(map);
+
+    DirectHandle<DescriptorArray> descriptors(
+        map->instance_descriptors(isolate_), isolate_);
+    {
+      DisallowGarbageCollection no_gc;
+      Tagged<String> first_key =
+          Cast<String>(descriptors->GetKey(InternalIndex(0)));
+      if (first_key->length() < kMaxShapeCacheKeyLength) {
+        String::FlatContent content = first_key->GetFlatContent(no_gc);
+        int slot =
+            content.IsOneByte()
+                ? ShapeCacheSlot(content.ToOneByteVector(), kShapeCacheSize)
+                : ShapeCacheSlot(content.ToUC16Vector(), kShapeCacheSize);
+        shape_cache_->set(slot, *map);
+      }
+    }
+    // The values are read by name, since the object itself may still have the
+    // deprecated map. They are pushed in reverse, so that the first property
+    // is visited first.
+    for (int i = map->NumberOfOwnDescriptors() - 1; i >= 0; --i) {
+      DirectHandle<Name> key(descriptors->GetKey(InternalIndex(i)), isolate_);
+      worklist.emplace_back(JSReceiver::GetDataProperty(isolate_, object, key),
+                            depth + 1);
+    }
+  }
+}
+
+template <typename Char>
+bool JsonParser<Char>::IsValidShapeHint(Tagged<Map> map) {
+  DisallowGarbageCollection no_gc;
+  if (map->instance_type() != JS_OBJECT_TYPE || map->is_dictionary_map() ||
+      !map->is_extensible() || map->IsDetached(isolate_) ||
+      map->prototype() != *isolate_->initial_object_prototype() ||
+      map->GetConstructor() != *object_constructor_) {
+    return false;
+  }
+  int property_count = map->NumberOfOwnDescriptors();
+  if (property_count == 0) return false;
+  // All properties have to be writable, enumerable in-object data fields with
+  // string keys.
+  if (map->GetInObjectProperties() - map->UnusedInObjectProperties() !=
+      property_count) {
+    return false;
+  }
+  Tagged<DescriptorArray> descriptors = map->instance_descriptors(isolate_);
+  for (InternalIndex i : map->IterateOwnDescriptors()) {
+    PropertyDetails details = descriptors->GetDetails(i);
+    if (details.kind() != PropertyKind::kData ||
+        details.location() != PropertyLocation::kField ||
+        details.attributes() != NONE || !IsString(descriptors->GetKey(i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
 template <typename Char>
 bool JsonParser<Char>::ParseJsonPropertyValue(const JsonString& key) {
   ExpectNext(JsonToken::COLON,
@@ -1671,11 +1840,17 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonObject(Handle<Map> feedback) {
 
   Consume(JsonToken::LBRACE);
   if (Check(JsonToken::RBRACE)) {
-    return factory()->NewJSObject(object_constructor_);
+    return factory()->NewJSObject(object_constructor_, allocation_);
   }
 
   JsonContinuation cont(isolate_, JsonContinuation::kObjectProperty,
                         property_stack_.size());
+  // Objects without a preceding sibling take their feedback from the last
+  // object in this parse that started with the same key.
+  int shape_cache_slot = -1;
+  if (feedback.is_null() && !shape_cache_.is_null()) {
+    feedback = LookupShapeCache(&shape_cache_slot);
+  }
   bool success;
   using FastIterableState = DescriptorArray::FastIterableState;
   const MessageTemplate first_token_msg =
@@ -1711,7 +1886,8 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonObject(Handle<Map> feedback) {
   }
 
   Expect(JsonToken::RBRACE, MessageTemplate::kJsonParseExpectedCommaOrRBrace);
-  Handle<Object> result = BuildJsonObject<false>(cont, feedback);
+  Handle<JSObject> result = BuildJsonObject<false>(cont, feedback);
+  if (shape_cache_slot >= 0) UpdateShapeCache(shape_cache_slot, result->map());
   property_stack_.resize(cont.index);
   return cont.scope.CloseAndEscape(result);
 }
@@ -1727,7 +1903,7 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonArray() {
 
   Consume(JsonToken::LBRACK);
   if (Check(JsonToken::RBRACK)) {
-    return factory()->NewJSArray(0, PACKED_SMI_ELEMENTS);
+    return factory()->NewJSArray(0, PACKED_SMI_ELEMENTS, allocation_);
   }
 
   HandleScope handle_scope(isolate_);
@@ -1771,14 +1947,20 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonArray() {
         static_cast<int>(smi_elements_.size() + double_elements_.size());
     Handle<JSArray> array;
     if (!saw_double) {
-      array = factory()->NewJSArray(PACKED_SMI_ELEMENTS, length, length);
+      array = factory()->NewJSArray(
+          PACKED_SMI_ELEMENTS, length, length,
+          ArrayStorageAllocationMode::DONT_INITIALIZE_ARRAY_ELEMENTS,
+          allocation_);
       DisallowGarbageCollection no_gc;
       Tagged<FixedArray> elements = Cast<FixedArray>(array->elements());
       for (int i = 0; i < length; i++) {
         elements->set(i, Smi::FromInt(smi_elements_[i]));
       }
     } else {
-      array = factory()->NewJSArray(PACKED_DOUBLE_ELEMENTS, length, length);
+      array = factory()->NewJSArray(
+          PACKED_DOUBLE_ELEMENTS, length, length,
+          ArrayStorageAllocationMode::DONT_INITIALIZE_ARRAY_ELEMENTS,
+          allocation_);
       DisallowGarbageCollection no_gc;
       Tagged<FixedDoubleArray> elements =
           Cast<FixedDoubleArray>(array->elements());
@@ -1802,7 +1984,7 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonArray() {
   }
   smi_elements_.resize(0);
   for (double element : double_elements_) {
-    element_stack_.emplace_back(factory()->NewNumber(element));
+    element_stack_.emplace_back(NewNumber(element));
   }
   double_elements_.resize(0);
 
@@ -1922,7 +2104,7 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue() {
           Consume(JsonToken::LBRACE);
           if (Check(JsonToken::RBRACE)) {
             // TODO(verwaest): Directly use the map instead.
-            value = factory()->NewJSObject(object_constructor_);
+            value = factory()->NewJSObject(object_constructor_, allocation_);
             if constexpr (should_track_json_source) {
               val_node = ObjectTwoHashTable::New(isolate_, 0);
             }
@@ -1952,7 +2134,8 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue() {
         case JsonToken::LBRACK:
           Consume(JsonToken::LBRACK);
           if (Check(JsonToken::RBRACK)) {
-            value = factory()->NewJSArray(0, PACKED_SMI_ELEMENTS);
+            value =
+                factory()->NewJSArray(0, PACKED_SMI_ELEMENTS, allocation_);
             if constexpr (should_track_json_source) {
               val_node = factory()->NewFixedArray(0);
             }
@@ -2170,7 +2353,7 @@ Handle<Object> JsonParser<Char>::ParseJsonNumber() {
   double double_number;
   int smi_number;
   if (ParseJsonNumberAsDoubleOrSmi(&double_number, &smi_number)) {
-    return factory()->NewHeapNumber(double_number);
+    return NewHeapNumber(double_number);
   }
   return handle(Smi::FromInt(smi_number), isolate_);
 }
@@ -2345,12 +2528,16 @@ Handle<String> JsonParser<Char>::MakeString(const JsonString& string,
   if (sizeof(Char) == 1 ? V8_LIKELY(!string.needs_conversion())
                         : string.needs_conversion()) {
     Handle<SeqOneByteString> intermediate =
-        factory()->NewRawOneByteString(string.length()).ToHandleChecked();
+        factory()
+            ->NewRawOneByteString(string.length(), allocation_)
+            .ToHandleChecked();
     return DecodeString(string, intermediate, hint);
   }
 
   Handle<SeqTwoByteString> intermediate =
-      factory()->NewRawTwoByteString(string.length()).ToHandleChecked();
+      factory()
+          ->NewRawTwoByteString(string.length(), allocation_)
+          .ToHandleChecked();
   return DecodeString(string, intermediate, hint);
 }
 
@@ -181,6 +181,24 @@ class JsonParser final {
     return result;
   }
 
+  // Parses |source| like Parse without a reviver, but takes the layout of the
+  // objects in |shape_hint| as feedback for the objects in |source| that start
+  // with the same property key. Arrays in the hint stand for arrays of objects
+  // like their first element.
+  V8_WARN_UNUSED_RESULT static MaybeHandle<Object> ParseWithShapeHint(
+      Isolate* isolate, Handle<String> source,
+      DirectHandle<JSReceiver> shape_hint) {
+    HighAllocationThroughputScope high_throughput_scope(
+        V8::GetCurrentPlatform());
+    JsonParser parser(isolate, source);
+    if (v8_flags.json_parse_shape_cache) {
+      parser.shape_cache_ =
+          isolate->factory()->NewFixedArray(kShapeCacheSize);
+      parser.SeedShapeCache(shape_hint);
+    }
+    return parser.ParseJson(isolate->factory()->undefined_value());
+  }
+
   static constexpr base::uc32 kEndOfString = static_cast<base::uc32>(-1);
   static constexpr base::uc32 kInvalidUnicodeCharacter =
       static_cast<base::uc32>(-1);
@@ -343,6 +361,16 @@ class JsonParser final {
                                            Handle<DescriptorArray> descriptors);
   V8_INLINE bool ParseJsonPropertyValue(const JsonString& key);
   V8_INLINE bool FastKeyMatch(const uint8_t* key_chars, uint32_t key_length);
+  // Looks up feedback for the object whose first property key is the next
+  // token in the shape cache. Sets |slot| to the cache entry the object's map
+  // should be recorded in, or to -1 if the key can't be cached.
+  Handle<Map> LookupShapeCache(int* slot);
+  void UpdateShapeCache(int slot, Tagged<Map> map);
+  // Records the maps of the objects in |hint| in the shape cache.
+  void SeedShapeCache(DirectHandle<JSReceiver> hint);
+  // Whether objects with |map| could have been created by the parser, which
+  // is required for maps that are used as feedback.
+  bool IsValidShapeHint(Tagged<Map> map);
 
   template <bool should_track_json_source>
   Handle<JSObject> BuildJsonObject(const JsonContinuation& cont,
@@ -375,12 +403,31 @@ class JsonParser final {
 
   inline Isolate* isolate() { return isolate_; }
   inline Factory* factory() { return isolate_->factory(); }
+
+  // Allocates a HeapNumber in the space of the result.
+  Handle<HeapNumber> NewHeapNumber(double value) {
+    return allocation_ == AllocationType::kOld
+               ? factory()->NewHeapNumber<AllocationType::kOld>(value)
+               : factory()->NewHeapNumber(value);
+  }
+  Handle<Number> NewNumber(double value) {
+    return allocation_ == AllocationType::kOld
+               ? factory()->NewNumber<AllocationType::kOld>(value)
+               : factory()->NewNumber(value);
+  }
   inline ReadOnlyRoots roots() { return ReadOnlyRoots(isolate_); }
   inline DirectHandle<JSFunction> object_constructor() {
     return object_constructor_;
   }
 
   static const int kInitialSpecialStringLength = 32;
+  // The shape cache is only set up for inputs that are long enough to contain
+  // repeated object layouts.
+  static const int kMinShapeCacheSourceLength = 1024;
+  static const int kShapeCacheSize = 64;
+  static const int kMaxShapeCacheKeyLength = 64;
+  static const int kMaxShapeHintDepth = 16;
+  static const int kMaxShapeHintNodes = 256;
 
   static void UpdatePointersCallback(void* parser) {
     reinterpret_cast<JsonParser<Char>*>(parser)->UpdatePointers();
@@ -415,6 +462,10 @@ class JsonParser final {
   JsonToken next_;
   // Indicates whether the bytes underneath source_ can relocate during GC.
   bool chars_may_relocate_;
+  // Where to allocate the objects of the result. Results of large inputs are
+  // allocated in old space directly, since they would likely survive the next
+  // scavenges and be copied twice otherwise.
+  AllocationType allocation_ = AllocationType::kYoung;
   Handle<JSFunction> object_constructor_;
   const Handle<String> original_source_;
   Handle<String> source_;
@@ -426,6 +477,11 @@ class JsonParser final {
   SmallVector<JsonProperty> property_stack_;
   SmallVector<double> double_elements_;
   SmallVector<int> smi_elements_;
+  // Maps the first property key of objects to the map of the last object with
+  // that key, which is used as feedback for objects that don't follow a
+  // sibling in an array, e.g. objects nested in array elements. Only used by
+  // the recursive parser.
+  Handle<FixedArray> shape_cache_;
 
   // Cached pointer to the raw chars in source. In case source is on-heap, we
   // register an UpdatePointers callback. For this reason, chars_, cursor_ and
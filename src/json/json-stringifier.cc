@@ -5,8 +5,10 @@
 #include "src/json/json-stringifier.h"
 
 #include <string_view>
+#include <vector>
 
 #include "hwy/highway.h"
+#include "include/v8-profiler.h"
 #include "src/base/strings.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
@@ -24,12 +26,139 @@
 #include "src/objects/smi.h"
 #include "src/objects/tagged.h"
 #include "src/strings/string-builder-inl.h"
+#include "src/strings/unicode-inl.h"
 
 namespace v8 {
 namespace internal {
 
 static constexpr char kJsonStringifierZoneName[] = "json-stringifier-zone";
 
+// Encodes the output of the stringifiers as UTF-8 and writes it to an
+// embedder's v8::OutputStream, in chunks of the stream's preferred size.
+class JsonStreamWriter {
+ public:
+  explicit JsonStreamWriter(v8::OutputStream* stream);
+
+  template <typename Char>
+  void Write(const Char* chars, size_t length);
+
+  // Starts writing from the beginning of the output again, e.g. when the
+  // slow stringifier takes over from the fast one. Output that has already
+  // been written to the stream is skipped when it is produced again. This
+  // relies on the new output starting with the one that was written, which
+  // holds for the fast stringifier as it bails out to the slow one before
+  // producing anything the slow one would not, and never calls into
+  // JavaScript, so the object graph is unchanged when the slow one starts.
+  // Debug builds check this.
+  void Rewind() { position_ = 0; }
+
+  // Writes the remaining output and ends the stream. Returns false if the
+  // stream aborted.
+  bool Finish();
+
+ private:
+  V8_INLINE void EncodeCharacter(base::uc16 c);
+  V8_INLINE void AppendByte(char byte) {
+    chunk_[chunk_length_++] = byte;
+    if (V8_UNLIKELY(chunk_length_ == chunk_.size())) WriteChunk();
+  }
+  void AppendEncoded(unibrow::uchar c);
+  void WriteChunk();
+
+  v8::OutputStream* const stream_;
+  std::vector<char> chunk_;
+  size_t chunk_length_ = 0;
+  // The number of characters produced since the last Rewind().
+  size_t position_ = 0;
+  // The number of characters encoded so far.
+  size_t encoded_ = 0;
+#ifdef DEBUG
+  // The characters encoded so far, to check those that are skipped.
+  std::vector<base::uc16> encoded_characters_;
+#endif  // DEBUG
+  // A lead surrogate is held back until the next character, which may be
+  // written separately, tells whether it starts a surrogate pair.
+  base::uc16 pending_lead_surrogate_ = 0;
+  bool aborted_ = false;
+};
+
+JsonStreamWriter::JsonStreamWriter(v8::OutputStream* stream)
+    : stream_(stream), chunk_(std::max(stream->GetChunkSize(), 1)) {}
+
+template <typename Char>
+void JsonStreamWriter::Write(const Char* chars, size_t length) {
+  if (position_ < encoded_) {
+    size_t skip = std::min(length, encoded_ - position_);
+#ifdef DEBUG
+    for (size_t i = 0; i < skip; i++) {
+      DCHECK_EQ(encoded_characters_[position_ + i], chars[i]);
+    }
+#endif  // DEBUG
+    position_ += skip;
+    chars += skip;
+    length -= skip;
+  }
+  position_ += length;
+  encoded_ += length;
+#ifdef DEBUG
+  encoded_characters_.insert(encoded_characters_.end(), chars, chars + length);
+#endif  // DEBUG
+  for (size_t i = 0; i < length && !aborted_; i++) EncodeCharacter(chars[i]);
+}
+
+void JsonStreamWriter::EncodeCharacter(base::uc16 c) {
+  if (V8_LIKELY(c <= unibrow::Utf8::kMaxOneByteChar &&
+                pending_lead_surrogate_ == 0)) {
+    return AppendByte(static_cast<char>(c));
+  }
+  if (pending_lead_surrogate_ != 0) {
+    base::uc16 lead = pending_lead_surrogate_;
+    pending_lead_surrogate_ = 0;
+    if (unibrow::Utf16::IsTrailSurrogate(c)) {
+      return AppendEncoded(unibrow::Utf16::CombineSurrogatePair(lead, c));
+    }
+    AppendEncoded(lead);
+  }
+  if (unibrow::Utf16::IsLeadSurrogate(c)) {
+    pending_lead_surrogate_ = c;
+    return;
+  }
+  AppendEncoded(c);
+}
+
+void JsonStreamWriter::AppendEncoded(unibrow::uchar c) {
+  char bytes[unibrow::Utf8::kMaxEncodedSize];
+  unsigned length = unibrow::Utf8::Encode(
+      bytes, c, unibrow::Utf16::kNoPreviousCharacter, false);
+  for (unsigned i = 0; i < length; i++) AppendByte(bytes[i]);
+}
+
+void JsonStreamWriter::WriteChunk() {
+  // After an abort, output is dropped.
+  if (!aborted_ && chunk_length_ > 0) {
+    int length = static_cast<int>(chunk_length_);
+    if (stream_->WriteAsciiChunk(chunk_.data(), length) ==
+        v8::OutputStream::kAbort) {
+      aborted_ = true;
+    }
+  }
+  chunk_length_ = 0;
+}
+
+bool JsonStreamWriter::Finish() {
+  // Output produced again after a Rewind() must not end before the output
+  // that was already written.
+  DCHECK_EQ(position_, encoded_);
+  if (pending_lead_surrogate_ != 0) {
+    AppendEncoded(pending_lead_surrogate_);
+    pending_lead_surrogate_ = 0;
+  }
+  WriteChunk();
+  if (aborted_) return false;
+  stream_->EndOfStream();
+  return true;
+}
+
 class JsonStringifier {
  public:
   explicit JsonStringifier(Isolate* isolate);
@@ -43,6 +172,13 @@ class JsonStringifier {
   V8_WARN_UNUSED_RESULT MaybeDirectHandle<Object> Stringify(
       Handle<JSAny> object, Handle<JSAny> replacer, Handle<Object> gap);
 
+  // Serializes `object` without a replacer, handing the output to `writer`
+  // whenever the current part is full instead of growing it. Returns false if
+  // an exception was thrown.
+  V8_WARN_UNUSED_RESULT bool StringifyToStream(Handle<JSAny> object,
+                                               Handle<Object> gap,
+                                               JsonStreamWriter* writer);
+
  private:
   enum Result { UNCHANGED, SUCCESS, EXCEPTION, NEED_STACK };
 
@@ -431,6 +567,7 @@ class JsonStringifier {
 
   V8_NOINLINE void Extend();
   V8_NOINLINE void ChangeEncoding();
+  void WriteCurrentPartToStream();
 
   Isolate* isolate_;
   String::Encoding encoding_;
@@ -446,6 +583,7 @@ class JsonStringifier {
   int stack_nesting_level_;
   bool overflowed_;
   bool need_stack_;
+  JsonStreamWriter* stream_writer_;
 
   using KeyObject = std::pair<Handle<Object>, Handle<Object>>;
   std::vector<KeyObject> stack_;
@@ -603,6 +741,7 @@ JsonStringifier::JsonStringifier(Isolate* isolate)
       stack_nesting_level_(0),
       overflowed_(false),
       need_stack_(false),
+      stream_writer_(nullptr),
       stack_(),
       key_cache_(isolate) {
   one_byte_ptr_ = one_byte_array_;
@@ -646,6 +785,34 @@ MaybeDirectHandle<Object> JsonStringifier::Stringify(Handle<JSAny> object,
   return MaybeDirectHandle<Object>();
 }
 
+bool JsonStringifier::StringifyToStream(Handle<JSAny> object,
+                                        Handle<Object> gap,
+                                        JsonStreamWriter* writer) {
+  if (!IsUndefined(*gap, isolate_) && !InitializeGap(gap)) {
+    CHECK(isolate_->has_exception());
+    return false;
+  }
+  stream_writer_ = writer;
+  // Restarting with a stack would serialize the output again after parts of
+  // it may have been written to the stream, so track the stack from the
+  // start.
+  need_stack_ = true;
+  Result result = SerializeObject(object);
+  DCHECK_NE(result, NEED_STACK);
+  if (result == EXCEPTION) {
+    CHECK(isolate_->has_exception());
+    return false;
+  }
+  DCHECK(result == SUCCESS || result == UNCHANGED);
+  // Only a single string that doesn't fit into a string part can overflow.
+  if (overflowed_) {
+    THROW_NEW_ERROR_RETURN_VALUE(isolate_, NewInvalidStringLengthError(),
+                                 false);
+  }
+  WriteCurrentPartToStream();
+  return true;
+}
+
 bool JsonStringifier::InitializeReplacer(Handle<JSAny> replacer) {
   DCHECK(property_list_.is_null());
   DCHECK(replacer_function_.is_null());
@@ -1765,6 +1932,12 @@ bool JsonStringifier::SerializeString(Handle<String> object) {
 }
 
 void JsonStringifier::Extend() {
+  if (stream_writer_ != nullptr && current_index_ > 0) {
+    // Reuse the current part once its contents are written to the stream.
+    // It is only grown if a single append needs more space.
+    WriteCurrentPartToStream();
+    return;
+  }
   if (part_length_ >= String::kMaxLength) {
     // Set the flag and carry on. Delay throwing the exception till the end.
     current_index_ = 0;
@@ -1800,6 +1973,16 @@ void JsonStringifier::ChangeEncoding() {
   one_byte_ptr_ = nullptr;
 }
 
+void JsonStringifier::WriteCurrentPartToStream() {
+  DCHECK_NOT_NULL(stream_writer_);
+  if (encoding_ == String::ONE_BYTE_ENCODING) {
+    stream_writer_->Write(one_byte_ptr_, current_index_);
+  } else {
+    stream_writer_->Write(two_byte_ptr_, current_index_);
+  }
+  current_index_ = 0;
+}
+
 template <typename Char>
 class OutBuffer {
  public:
@@ -1845,6 +2028,7 @@ class OutBuffer {
   }
   template <typename Dst>
   void CopyTo(Dst* dst) {
+    DCHECK_NULL(stream_writer_);
     if (ZoneUsed()) {
       // Copy stack segment.
       CopyChars(dst, stack_buffer_, stack_buffer_size_);
@@ -1866,6 +2050,17 @@ class OutBuffer {
     }
   }
 
+  // In streaming mode, the buffered output is written to `writer` whenever
+  // the buffer is full, and the buffer is reused.
+  void set_stream_writer(JsonStreamWriter* writer) { stream_writer_ = writer; }
+  // Writes the buffered output to the stream.
+  void Flush() {
+    DCHECK_NOT_NULL(stream_writer_);
+    Char* begin = ZoneUsed() ? segments_->last().begin() : stack_buffer_;
+    stream_writer_->Write(begin, cur_ - begin);
+    cur_ = begin;
+  }
+
  private:
   static constexpr uint32_t kInitialSegmentSize = 2 * KB;
   static constexpr uint32_t kMaxSegmentSize = 32 * KB;
@@ -1880,6 +2075,10 @@ class OutBuffer {
   static constexpr size_t kStackBufferSize = 256;
 
   V8_NOINLINE V8_PRESERVE_MOST void Extend(size_t min_size) {
+    if (stream_writer_ != nullptr) {
+      Flush();
+      if (ZoneUsed() && min_size <= SegmentFreeChars()) return;
+    }
     if (ZoneUsed()) {
       segments_->last().Truncate(CurSegmentLength());
     } else {
@@ -1887,8 +2086,11 @@ class OutBuffer {
       zone_.emplace(allocator_, kJsonStringifierZoneName);
       segments_.emplace(1, &zone_.value());
     }
+    // When streaming, a single segment of the maximum size is reused.
     const size_t new_segment_size =
-        std::max(min_size, SegmentCapacity(segments_->length()));
+        std::max(min_size, stream_writer_ != nullptr
+                               ? kMaxSegmentSize
+                               : SegmentCapacity(segments_->length()));
     segments_->Add(zone_->AllocateVector<Char>(new_segment_size),
                    &zone_.value());
     cur_ = segments_->last().begin();
@@ -1927,6 +2129,7 @@ class OutBuffer {
   Char* segment_end_;
   std::optional<Zone> zone_;
   std::optional<ZoneList<base::Vector<Char>>> segments_;
+  JsonStreamWriter* stream_writer_ = nullptr;
 #ifdef DEBUG
   size_t current_requested_capacity_;
 #endif
@@ -2165,6 +2368,10 @@ class FastJsonStringifier {
   void CopyResultTo(DstChar* out_buffer) {
     buffer_.CopyTo(out_buffer);
   }
+  void set_stream_writer(JsonStreamWriter* writer) {
+    buffer_.set_stream_writer(writer);
+  }
+  void FlushResult() { buffer_.Flush(); }
   V8_INLINE FastJsonStringifierResult
   SerializeObject(Tagged<JSAny> object, const DisallowGarbageCollection& no_gc);
 
@@ -3566,6 +3773,49 @@ MaybeDirectHandle<Object> FastJsonStringify(Isolate* isolate,
 
 }  // namespace
 
+Maybe<bool> JsonStringifyToStream(Isolate* isolate, Handle<JSAny> object,
+                                  Handle<Object> gap,
+                                  v8::OutputStream* stream) {
+  JsonStreamWriter writer(stream);
+  DirectHandle<JSAny> undefined = isolate->factory()->undefined_value();
+  if (CanUseFastStringifier(undefined, gap)) {
+    FastJsonStringifierResult result;
+    {
+      DisallowGarbageCollection no_gc;
+      FastJsonStringifier<uint8_t> one_byte_stringifier(isolate);
+      one_byte_stringifier.set_stream_writer(&writer);
+      result = one_byte_stringifier.SerializeObject(*object, no_gc);
+      if (result == CHANGE_ENCODING) {
+        // The two-byte stringifier only produces the output that follows the
+        // one-byte stringifier's, which can therefore be written first.
+        one_byte_stringifier.FlushResult();
+        FastJsonStringifier<base::uc16> two_byte_stringifier(isolate);
+        two_byte_stringifier.set_stream_writer(&writer);
+        result = two_byte_stringifier.ResumeFrom(one_byte_stringifier, no_gc);
+        DCHECK_NE(result, CHANGE_ENCODING);
+        if (result == SUCCESS) two_byte_stringifier.FlushResult();
+      } else if (result == SUCCESS) {
+        one_byte_stringifier.FlushResult();
+      }
+    }
+    if (V8_LIKELY(result == SUCCESS || result == UNDEFINED)) {
+      return Just(writer.Finish());
+    } else if (result == EXCEPTION) {
+      CHECK(isolate->has_exception());
+      return Nothing<bool>();
+    }
+    DCHECK_EQ(result, SLOW_PATH);
+    // The slow path produces the same output from the start, of which the
+    // part that was already written is skipped (see JsonStreamWriter).
+    writer.Rewind();
+  }
+  JsonStringifier stringifier(isolate);
+  if (!stringifier.StringifyToStream(object, gap, &writer)) {
+    return Nothing<bool>();
+  }
+  return Just(writer.Finish());
+}
+
 MaybeDirectHandle<Object> JsonStringify(Isolate* isolate, Handle<JSAny> object,
                                         Handle<JSAny> replacer,
                                         Handle<Object> gap) {
@@ -83,7 +83,9 @@ namespace v8::internal {
   V(Isolate_LocaleConfigurationChangeNotification)         \
   V(Isolate_ValidateAndCanonicalizeUnicodeLocaleId)        \
   V(JSON_Parse)                                            \
+  V(JSON_ParseWithShapeHint)                               \
   V(JSON_Stringify)                                        \
+  V(JSON_StringifyToStream)                                \
   V(Map_AsArray)                                           \
   V(Map_Clear)                                             \
   V(Map_Delete)                                            \
@@ -237,6 +239,7 @@ namespace v8::internal {
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, AllocateFPRegisters)               \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, AllocateSimd128Registers)          \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, AllocateGeneralRegisters)          \
+  ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, AllocateRegistersConcurrently)     \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, AssembleCode)                      \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, AssignSpillSlots)                  \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, BitcastElision)                    \
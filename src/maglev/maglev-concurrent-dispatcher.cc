@@ -365,6 +365,10 @@ void MaglevConcurrentDispatcher::EnqueueJob(
   job_handle_->NotifyConcurrencyIncrease();
 }
 
+size_t MaglevConcurrentDispatcher::QueueLength() const {
+  return incoming_queue_.size();
+}
+
 void MaglevConcurrentDispatcher::FinalizeFinishedJobs() {
   HandleScope handle_scope(isolate_);
   while (!outgoing_queue_.IsEmpty()) {
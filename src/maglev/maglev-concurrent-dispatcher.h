@@ -97,6 +97,9 @@ class V8_EXPORT_PRIVATE MaglevConcurrentDispatcher final {
 
   bool is_enabled() const { return static_cast<bool>(job_handle_); }
 
+  // Returns the number of jobs waiting for a compile thread.
+  size_t QueueLength() const;
+
  private:
   Isolate* const isolate_;
   std::unique_ptr<JobHandle> job_handle_;
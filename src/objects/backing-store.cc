@@ -59,6 +59,9 @@ size_t GetReservationSize(bool has_guard_regions, size_t byte_capacity,
   if (has_guard_regions) {
     if (is_wasm_memory64) {
       DCHECK_LE(byte_capacity, wasm::kMaxMemory64Size);
+      if (v8_flags.wasm_memory64_clamp_bounds_checks) {
+        return wasm::kMaxMemory64Size + wasm::kMemory64ClampGuardSize;
+      }
       return wasm::kMaxMemory64Size;
     } else {
       static_assert(kFullGuardSize32 >= size_t{4} * GB);
@@ -752,6 +752,66 @@ bool FeedbackNexus::ConfigureMegamorphic(IcCheckType property_type) {
   return update_required;
 }
 
+namespace {
+
+// Returns the next step above |feedback| in the lattice
+// Number < NumberOrOddball < Any, for feedback other than kAny.
+template <typename Feedback>
+int GeneralizeNumberFeedback(int feedback) {
+  DCHECK_NE(feedback, Feedback::kAny);
+  for (int step : {Feedback::kNumber, Feedback::kNumberOrOddball}) {
+    if (feedback != step && (feedback | step) == step) return step;
+  }
+  return Feedback::kAny;
+}
+
+}  // namespace
+
+bool FeedbackNexus::Generalize() {
+  DisallowGarbageCollection no_gc;
+  FeedbackSlotKind slot_kind = kind();
+  switch (slot_kind) {
+    case FeedbackSlotKind::kBinaryOp: {
+      int feedback = GetFeedback().ToSmi().value();
+      if (feedback == BinaryOperationFeedback::kNone ||
+          feedback == BinaryOperationFeedback::kAny) {
+        return false;
+      }
+      int generalized = GeneralizeNumberFeedback<BinaryOperationFeedback>(feedback);
+      SetFeedback(Smi::FromInt(generalized), SKIP_WRITE_BARRIER);
+      return true;
+    }
+    case FeedbackSlotKind::kCompareOp: {
+      int feedback = GetFeedback().ToSmi().value();
+      if (feedback == CompareOperationFeedback::kNone ||
+          feedback == CompareOperationFeedback::kAny) {
+        return false;
+      }
+      int generalized = GeneralizeNumberFeedback<CompareOperationFeedback>(feedback);
+      SetFeedback(Smi::FromInt(generalized), SKIP_WRITE_BARRIER);
+      return true;
+    }
+    case FeedbackSlotKind::kCall:
+      if (GetSpeculationMode() == SpeculationMode::kDisallowSpeculation) {
+        return false;
+      }
+      SetSpeculationMode(SpeculationMode::kDisallowSpeculation);
+      return true;
+    default:
+      break;
+  }
+
+  if (IsLoadICKind(slot_kind) || IsSetNamedICKind(slot_kind) ||
+      IsDefineNamedOwnICKind(slot_kind)) {
+    return ConfigureMegamorphic(IcCheckType::kProperty);
+  }
+  if (IsKeyedLoadICKind(slot_kind) || IsKeyedHasICKind(slot_kind) ||
+      IsKeyedStoreICKind(slot_kind) || IsDefineKeyedOwnICKind(slot_kind)) {
+    return ConfigureMegamorphic(GetKeyType());
+  }
+  return false;
+}
+
 Tagged<Map> FeedbackNexus::GetFirstMap() const {
   FeedbackIterator it(this);
   if (!it.done()) {
@@ -996,6 +996,10 @@ class V8_EXPORT_PRIVATE FeedbackNexus final {
   // was changed. Extra feedback is cleared if the 0 parameter version is used.
   bool ConfigureMegamorphic();
   bool ConfigureMegamorphic(IcCheckType property_type);
+  // Generalize() widens the feedback by one step (e.g. SignedSmall to Number,
+  // polymorphic to megamorphic, speculative calls to non-speculative ones).
+  // Returns true if the state of the underlying vector was changed.
+  bool Generalize();
 
   inline Tagged<MaybeObject> GetFeedback() const;
   inline Tagged<MaybeObject> GetFeedbackExtra() const;
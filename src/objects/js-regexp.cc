@@ -396,13 +396,14 @@ bool IrRegExpData::MarkedForTierUp() {
 
 void IrRegExpData::ResetLastTierUpTick() {
   DCHECK(v8_flags.regexp_tier_up);
+  if (TierUpInProgress()) return;
   int tier_up_ticks = ticks_until_tier_up();
   set_ticks_until_tier_up(tier_up_ticks + 1);
 }
 
 void IrRegExpData::TierUpTick() {
   int tier_up_ticks = ticks_until_tier_up();
-  if (tier_up_ticks == 0) {
+  if (tier_up_ticks == 0 || tier_up_ticks == JSRegExp::kTierUpInProgressValue) {
     return;
   }
 
@@ -414,6 +415,18 @@ void IrRegExpData::MarkTierUpForNextExec() {
   set_ticks_until_tier_up(0);
 }
 
+// While native code is compiled concurrently, the regexp is neither ticking
+// nor marked for tier-up, so that the interpreter keeps running it.
+bool IrRegExpData::TierUpInProgress() {
+  return CanTierUp() &&
+         ticks_until_tier_up() == JSRegExp::kTierUpInProgressValue;
+}
+
+void IrRegExpData::MarkTierUpInProgress() {
+  DCHECK(MarkedForTierUp());
+  set_ticks_until_tier_up(JSRegExp::kTierUpInProgressValue);
+}
+
 bool IrRegExpData::ShouldProduceBytecode() {
   return v8_flags.regexp_interpret_all ||
          (v8_flags.regexp_tier_up && !MarkedForTierUp());
@@ -137,6 +137,10 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
   // tier-up to the compiler immediately, instead of using the interpreter.
   static constexpr int kTierUpForSubjectLengthValue = 1000;
 
+  // The tier-up ticks value while native code is compiled concurrently. The
+  // regexp keeps being interpreted until the code is installed.
+  static constexpr int kTierUpInProgressValue = -2;
+
   // Maximum number of captures allowed.
   static constexpr int kMaxCaptures = 1 << 16;
 
@@ -268,6 +272,8 @@ class IrRegExpData : public RegExpData {
   void ResetLastTierUpTick();
   void TierUpTick();
   void MarkTierUpForNextExec();
+  bool TierUpInProgress();
+  void MarkTierUpInProgress();
   bool ShouldProduceBytecode();
 
   void DiscardCompiledCodeForSerialization();
@@ -12,6 +12,7 @@
 #include "include/v8-wasm.h"
 #include "src/api/api-inl.h"
 #include "src/base/logging.h"
+#include "src/base/memory.h"
 #include "src/base/platform/memory.h"
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
@@ -79,6 +80,9 @@ namespace internal {
 //             unknown tags)
 // Version 14: flags for JSArrayBufferViews
 // Version 15: support for shared objects with an explicit tag
+// Version 16: raw encodings for arrays of numbers, and objects with the keys
+//             factored out into shapes (only written if requested, see
+//             kDefaultTargetVersion)
 //
 // WARNING: Increasing this value is a change which cannot safely be rolled
 // back without breaking compatibility with data stored on disk. It is
@@ -87,10 +91,16 @@ namespace internal {
 //
 // Recent changes are routinely reverted in preparation for branch, and this
 // has been the cause of at least one bug in the past.
-static const uint32_t kLatestVersion = 15;
+static const uint32_t kLatestVersion = 16;
 static_assert(kLatestVersion == v8::CurrentValueSerializerFormatVersion(),
               "Exported format version must match latest version.");
 
+// The version written unless the embedder opts into a newer one, so that
+// data can still be read by V8 versions which only read up to this version.
+static const uint32_t kDefaultTargetVersion = 15;
+// The oldest version the serializer can write.
+static const uint32_t kMinTargetVersion = 15;
+
 namespace {
 // For serializing JSArrayBufferView flags. Instead of serializing /
 // deserializing the flags directly, we serialize them bit by bit. This is for
@@ -102,6 +112,10 @@ using JSArrayBufferViewIsBackedByRab =
 
 }  // namespace
 
+// Strings shorter than this are always copied, even if strings are shared;
+// a conveyor entry costs more than the copy.
+static constexpr uint32_t kMinSharedStringLength = 256;
+
 template <typename T>
 static size_t BytesNeededForVarint(T value) {
   static_assert(std::is_integral_v<T> && std::is_unsigned_v<T>,
@@ -209,6 +223,17 @@ enum class SerializationTag : uint8_t {
   // A list of (subtag: ErrorTag, [subtag dependent data]). See ErrorTag for
   // details.
   kError = 'r',
+  // Beginning of a dense JS array of doubles. length:uint32_t, then |length|
+  // raw doubles in host byte order, followed by properties as key/value pairs
+  // and kEndDenseJSArray. |length| is never zero.
+  kBeginDenseDoubleJSArray = 'E',
+  // Like kBeginDenseDoubleJSArray, but with raw int32_t elements.
+  kBeginDenseInt32JSArray = 'J',
+  // A JS object with the same keys as an earlier one. shapeID:uint32_t; if
+  // this is the first use of the shape, the ID is the number of shapes so far
+  // and it is followed by numKeys:uint32_t and the keys as strings. Then one
+  // value per key, or kTheHole if the property is absent.
+  kBeginShapedJSObject = 'h',
 
   // The following tags are reserved because they were in use in Chromium before
   // the kHostObject tag was introduced in format version 13, at
@@ -299,7 +324,9 @@ ValueSerializer::ValueSerializer(Isolate* isolate,
       zone_(isolate->allocator(), ZONE_NAME),
       id_map_(isolate->heap(), ZoneAllocationPolicy(&zone_)),
       array_buffer_transfer_map_(isolate->heap(),
-                                 ZoneAllocationPolicy(&zone_)) {
+                                 ZoneAllocationPolicy(&zone_)),
+      object_shape_map_(isolate->heap(), ZoneAllocationPolicy(&zone_)),
+      target_version_(kDefaultTargetVersion) {
   if (delegate_) {
     v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
     has_custom_host_objects_ = delegate_->HasCustomHostObject(v8_isolate);
@@ -318,13 +345,22 @@ ValueSerializer::~ValueSerializer() {
 
 void ValueSerializer::WriteHeader() {
   WriteTag(SerializationTag::kVersion);
-  WriteVarint(kLatestVersion);
+  WriteVarint(target_version_);
+}
+
+bool ValueSerializer::SetTargetVersion(uint32_t version) {
+  if (version < kMinTargetVersion || version > kLatestVersion) return false;
+  DCHECK_EQ(0u, buffer_size_);
+  target_version_ = version;
+  return true;
 }
 
 void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   treat_array_buffer_views_as_host_objects_ = mode;
 }
 
+void ValueSerializer::SetShareStrings(bool mode) { share_strings_ = mode; }
+
 void ValueSerializer::WriteTag(SerializationTag tag) {
   uint8_t raw_tag = static_cast<uint8_t>(tag);
   WriteRawBytes(&raw_tag, sizeof(raw_tag));
@@ -509,6 +545,10 @@ Maybe<bool> ValueSerializer::WriteObject(DirectHandle<Object> object) {
     }
     default:
       if (InstanceTypeChecker::IsString(instance_type)) {
+        if (share_strings_ &&
+            Cast<String>(*object)->length() >= kMinSharedStringLength) {
+          return WriteSharedString(Cast<String>(object));
+        }
         WriteString(Cast<String>(object));
         return ThrowIfOutOfMemory();
       } else if (InstanceTypeChecker::IsJSReceiver(instance_type)) {
@@ -682,6 +722,22 @@ Maybe<bool> ValueSerializer::WriteJSReceiver(
   return ThrowDataCloneError(MessageTemplate::kDataCloneError, receiver);
 }
 
+// Returns the number of properties an object with |map| has in its shape, or
+// zero if the object can't be written with a shape. That is the case unless
+// all enumerable string-keyed properties are data fields.
+static uint32_t CountObjectShapeKeys(Isolate* isolate, Tagged<Map> map) {
+  Tagged<DescriptorArray> descriptors = map->instance_descriptors(isolate);
+  uint32_t num_keys = 0;
+  for (InternalIndex i : map->IterateOwnDescriptors()) {
+    if (!IsString(descriptors->GetKey(i), isolate)) continue;
+    PropertyDetails details = descriptors->GetDetails(i);
+    if (details.IsDontEnum()) continue;
+    if (details.location() != PropertyLocation::kField) return 0;
+    num_keys++;
+  }
+  return num_keys;
+}
+
 Maybe<bool> ValueSerializer::WriteJSObject(DirectHandle<JSObject> object) {
   DCHECK(!IsCustomElementsReceiverMap(object->map()));
   const bool can_serialize_fast =
@@ -689,6 +745,10 @@ Maybe<bool> ValueSerializer::WriteJSObject(DirectHandle<JSObject> object) {
   if (!can_serialize_fast) return WriteJSObjectSlow(object);
 
   DirectHandle<Map> map(object->map(), isolate_);
+  if (target_version_ >= 16 && (object_shape_map_.Find(*map) ||
+                                CountObjectShapeKeys(isolate_, *map) > 0)) {
+    return WriteShapedJSObject(object, map);
+  }
   WriteTag(SerializationTag::kBeginJSObject);
 
   // Write out fast properties as long as they are only data properties and the
@@ -731,6 +791,60 @@ Maybe<bool> ValueSerializer::WriteJSObject(DirectHandle<JSObject> object) {
   return ThrowIfOutOfMemory();
 }
 
+Maybe<bool> ValueSerializer::WriteShapedJSObject(DirectHandle<JSObject> object,
+                                                 DirectHandle<Map> map) {
+  WriteTag(SerializationTag::kBeginShapedJSObject);
+
+  // The keys are written along with the first object of each shape; later
+  // objects only refer to the shape by its ID.
+  auto find_result = object_shape_map_.FindOrInsert(*map);
+  if (find_result.already_exists) {
+    WriteVarint<uint32_t>(*find_result.entry);
+  } else {
+    *find_result.entry = next_object_shape_id_++;
+    WriteVarint<uint32_t>(*find_result.entry);
+    WriteVarint<uint32_t>(CountObjectShapeKeys(isolate_, *map));
+    for (InternalIndex i : map->IterateOwnDescriptors()) {
+      Tagged<Name> key = map->instance_descriptors(isolate_)->GetKey(i);
+      if (!IsString(key, isolate_)) continue;
+      if (map->instance_descriptors(isolate_)->GetDetails(i).IsDontEnum()) {
+        continue;
+      }
+      WriteString(direct_handle(Cast<String>(key), isolate_));
+    }
+  }
+
+  // Write out one value per key. Serializing a value can have side effects,
+  // in which case the remaining values are looked up like in WriteJSObject.
+  bool map_changed = false;
+  for (InternalIndex i : map->IterateOwnDescriptors()) {
+    DirectHandle<Name> key(map->instance_descriptors(isolate_)->GetKey(i),
+                           isolate_);
+    if (!IsString(*key, isolate_)) continue;
+    PropertyDetails details =
+        map->instance_descriptors(isolate_)->GetDetails(i);
+    if (details.IsDontEnum()) continue;
+
+    DirectHandle<Object> value;
+    if (V8_LIKELY(!map_changed)) map_changed = *map != object->map();
+    if (V8_LIKELY(!map_changed)) {
+      DCHECK_EQ(PropertyLocation::kField, details.location());
+      FieldIndex field_index = FieldIndex::ForDetails(*map, details);
+      value = direct_handle(object->RawFastPropertyAt(field_index), isolate_);
+    } else {
+      // If the property is no longer found, mark it as absent.
+      LookupIterator it(isolate_, object, key, LookupIterator::OWN);
+      if (!it.IsFound()) {
+        WriteTag(SerializationTag::kTheHole);
+        continue;
+      }
+      if (!Object::GetProperty(&it).ToHandle(&value)) return Nothing<bool>();
+    }
+    if (!WriteObject(value).FromMaybe(false)) return Nothing<bool>();
+  }
+  return ThrowIfOutOfMemory();
+}
+
 Maybe<bool> ValueSerializer::WriteJSObjectSlow(DirectHandle<JSObject> object) {
   WriteTag(SerializationTag::kBeginJSObject);
   DirectHandle<FixedArray> keys;
@@ -763,34 +877,24 @@ Maybe<bool> ValueSerializer::WriteJSArray(DirectHandle<JSArray> array) {
 
   if (should_serialize_densely) {
     DCHECK_LE(length, static_cast<uint32_t>(FixedArray::kMaxLength));
-    WriteTag(SerializationTag::kBeginDenseJSArray);
-    WriteVarint<uint32_t>(length);
+    const ElementsKind kind = array->GetElementsKind(cage_base);
     uint32_t i = 0;
 
+    // Arrays of numbers are written as a block of raw values. Elements are
+    // empty_fixed_array, not a FixedDoubleArray, if the array is empty, so
+    // those take the generic encoding.
+    if (target_version_ >= 16 && length > 0 &&
+        (kind == PACKED_SMI_ELEMENTS || kind == PACKED_DOUBLE_ELEMENTS)) {
+      WriteDenseNumberJSArrayElements(array, length);
+      i = length;
+    } else {
+      WriteTag(SerializationTag::kBeginDenseJSArray);
+      WriteVarint<uint32_t>(length);
+    }
+
     // Fast paths. Note that PACKED_ELEMENTS in particular can bail due to the
     // structure of the elements changing.
-    switch (array->GetElementsKind(cage_base)) {
-      case PACKED_SMI_ELEMENTS: {
-        DisallowGarbageCollection no_gc;
-        Tagged<FixedArray> elements = Cast<FixedArray>(array->elements());
-        for (i = 0; i < length; i++) {
-          WriteSmi(Cast<Smi>(elements->get(i)));
-        }
-        break;
-      }
-      case PACKED_DOUBLE_ELEMENTS: {
-        // Elements are empty_fixed_array, not a FixedDoubleArray, if the array
-        // is empty. No elements to encode in this case anyhow.
-        if (length == 0) break;
-        DisallowGarbageCollection no_gc;
-        Tagged<FixedDoubleArray> elements =
-            Cast<FixedDoubleArray>(array->elements());
-        for (i = 0; i < length; i++) {
-          WriteTag(SerializationTag::kDouble);
-          WriteDouble(elements->get_scalar(i));
-        }
-        break;
-      }
+    switch (kind) {
       case PACKED_ELEMENTS: {
         DirectHandle<Object> old_length(array->length(cage_base), isolate_);
         for (; i < length; i++) {
@@ -862,6 +966,37 @@ Maybe<bool> ValueSerializer::WriteJSArray(DirectHandle<JSArray> array) {
   return ThrowIfOutOfMemory();
 }
 
+void ValueSerializer::WriteDenseNumberJSArrayElements(
+    DirectHandle<JSArray> array, uint32_t length) {
+  DCHECK_LT(0u, length);
+  DisallowGarbageCollection no_gc;
+  uint8_t* dest;
+  if (array->GetElementsKind() == PACKED_SMI_ELEMENTS) {
+    // Smis are written as int32_t, since their width depends on the build.
+    WriteTag(SerializationTag::kBeginDenseInt32JSArray);
+    WriteVarint<uint32_t>(length);
+    if (!ReserveRawBytes(length * sizeof(int32_t)).To(&dest)) return;
+    Tagged<FixedArray> elements = Cast<FixedArray>(array->elements());
+    for (uint32_t i = 0; i < length; i++) {
+      base::WriteUnalignedValue<int32_t>(
+          reinterpret_cast<Address>(dest + i * sizeof(int32_t)),
+          Smi::ToInt(elements->get(i)));
+    }
+  } else {
+    DCHECK_EQ(PACKED_DOUBLE_ELEMENTS, array->GetElementsKind());
+    WriteTag(SerializationTag::kBeginDenseDoubleJSArray);
+    WriteVarint<uint32_t>(length);
+    if (!ReserveRawBytes(length * sizeof(double)).To(&dest)) return;
+    Tagged<FixedDoubleArray> elements =
+        Cast<FixedDoubleArray>(array->elements());
+    for (uint32_t i = 0; i < length; i++) {
+      base::WriteUnalignedValue<double>(
+          reinterpret_cast<Address>(dest + i * sizeof(double)),
+          elements->get_scalar(i));
+    }
+  }
+}
+
 void ValueSerializer::WriteJSDate(Tagged<JSDate> date) {
   WriteTag(SerializationTag::kDate);
   WriteDouble(date->value());
@@ -1249,6 +1384,20 @@ Maybe<bool> ValueSerializer::WriteSharedObject(
   return ThrowIfOutOfMemory();
 }
 
+Maybe<bool> ValueSerializer::WriteSharedString(DirectHandle<String> string) {
+  // Without a shared string table the string can't be shared, so copy it.
+  if (!delegate_ || !v8_flags.shared_string_table) {
+    WriteString(string);
+    return ThrowIfOutOfMemory();
+  }
+  // This copies the string into the shared heap unless it can be shared in
+  // place. Either way, the deserializing isolate uses it without a copy.
+  // Only strings are shared: other objects in the graph have maps and
+  // prototypes of the sending isolate, and a bulk heap-to-heap copy would
+  // have to rewrite those, which is what deserialization already does.
+  return WriteSharedObject(String::Share(isolate_, string));
+}
+
 Maybe<bool> ValueSerializer::WriteHostObject(DirectHandle<JSObject> object) {
   WriteTag(SerializationTag::kHostObject);
   if (!delegate_) {
@@ -1343,6 +1492,8 @@ ValueDeserializer::ValueDeserializer(Isolate* isolate,
       position_(data.begin()),
       end_(data.end()),
       id_map_(isolate->global_handles()->Create(
+          ReadOnlyRoots(isolate_).empty_fixed_array())),
+      object_shapes_(isolate->global_handles()->Create(
           ReadOnlyRoots(isolate_).empty_fixed_array())) {}
 
 ValueDeserializer::ValueDeserializer(Isolate* isolate, const uint8_t* data,
@@ -1352,11 +1503,14 @@ ValueDeserializer::ValueDeserializer(Isolate* isolate, const uint8_t* data,
       position_(data),
       end_(data + size),
       id_map_(isolate->global_handles()->Create(
+          ReadOnlyRoots(isolate_).empty_fixed_array())),
+      object_shapes_(isolate->global_handles()->Create(
           ReadOnlyRoots(isolate_).empty_fixed_array())) {}
 
 ValueDeserializer::~ValueDeserializer() {
   DCHECK_LE(position_, end_);
   GlobalHandles::Destroy(id_map_.location());
+  GlobalHandles::Destroy(object_shapes_.location());
 
   IndirectHandle<Object> transfer_map_handle;
   if (array_buffer_transfer_map_.ToHandle(&transfer_map_handle)) {
@@ -1737,6 +1891,17 @@ MaybeDirectHandle<Object> ValueDeserializer::ReadObjectInternal() {
       // If the data doesn't support shared values because it is from an older
       // version, treat the tag as unknown.
       [[fallthrough]];
+    case SerializationTag::kBeginDenseDoubleJSArray:
+    case SerializationTag::kBeginDenseInt32JSArray:
+    case SerializationTag::kBeginShapedJSObject:
+      // Likewise for the bulk encodings, which were added in version 16.
+      if (version_ >= 16) {
+        if (tag == SerializationTag::kBeginShapedJSObject) {
+          return ReadShapedJSObject();
+        }
+        return ReadDenseNumberJSArray(tag);
+      }
+      [[fallthrough]];
     default:
       // Before there was an explicit tag for host objects, all unknown tags
       // were delegated to the host.
@@ -1930,6 +2095,74 @@ MaybeDirectHandle<JSArray> ValueDeserializer::ReadDenseJSArray() {
   return scope.CloseAndEscape(array);
 }
 
+MaybeDirectHandle<JSArray> ValueDeserializer::ReadDenseNumberJSArray(
+    SerializationTag tag) {
+  DCHECK(tag == SerializationTag::kBeginDenseDoubleJSArray ||
+         tag == SerializationTag::kBeginDenseInt32JSArray);
+  // If we are at the end of the stack, abort. This function may recurse.
+  STACK_CHECK(isolate_, MaybeDirectHandle<JSArray>());
+
+  const bool is_double = tag == SerializationTag::kBeginDenseDoubleJSArray;
+  const size_t element_size = is_double ? sizeof(double) : sizeof(int32_t);
+  uint32_t length;
+  base::Vector<const uint8_t> raw_elements;
+  if (!ReadVarint<uint32_t>().To(&length) || length == 0 ||
+      length > static_cast<uint32_t>(FixedArray::kMaxLength) ||
+      !ReadRawBytes(size_t{length} * element_size).To(&raw_elements)) {
+    return MaybeDirectHandle<JSArray>();
+  }
+  const Address raw = reinterpret_cast<Address>(raw_elements.begin());
+
+  uint32_t id = next_id_++;
+  HandleScope scope(isolate_);
+  DirectHandle<JSArray> array;
+  bool all_smis = !is_double;
+  for (uint32_t i = 0; all_smis && i < length; i++) {
+    // Smis are narrower than int32_t with pointer compression.
+    all_smis = Smi::IsValid(
+        base::ReadUnalignedValue<int32_t>(raw + i * sizeof(int32_t)));
+  }
+  if (all_smis) {
+    array = isolate_->factory()->NewJSArray(PACKED_SMI_ELEMENTS, length,
+                                            length);
+    DisallowGarbageCollection no_gc;
+    Tagged<FixedArray> elements = Cast<FixedArray>(array->elements());
+    for (uint32_t i = 0; i < length; i++) {
+      elements->set(i, Smi::FromInt(base::ReadUnalignedValue<int32_t>(
+                           raw + i * sizeof(int32_t))));
+    }
+  } else {
+    array = isolate_->factory()->NewJSArray(PACKED_DOUBLE_ELEMENTS, length,
+                                            length);
+    DisallowGarbageCollection no_gc;
+    Tagged<FixedDoubleArray> elements =
+        Cast<FixedDoubleArray>(array->elements());
+    for (uint32_t i = 0; i < length; i++) {
+      // FixedDoubleArray::set canonicalizes NaNs, so the data can't forge the
+      // hole.
+      elements->set(i, is_double ? base::ReadUnalignedValue<double>(
+                                       raw + i * sizeof(double))
+                                 : base::ReadUnalignedValue<int32_t>(
+                                       raw + i * sizeof(int32_t)));
+    }
+  }
+  AddObjectWithID(id, array);
+
+  uint32_t num_properties;
+  uint32_t expected_num_properties;
+  uint32_t expected_length;
+  if (!ReadJSObjectProperties(array, SerializationTag::kEndDenseJSArray, false)
+           .To(&num_properties) ||
+      !ReadVarint<uint32_t>().To(&expected_num_properties) ||
+      !ReadVarint<uint32_t>().To(&expected_length) ||
+      num_properties != expected_num_properties || length != expected_length) {
+    return MaybeDirectHandle<JSArray>();
+  }
+
+  DCHECK(HasObjectWithID(id));
+  return scope.CloseAndEscape(array);
+}
+
 MaybeDirectHandle<JSDate> ValueDeserializer::ReadJSDate() {
   double value;
   if (!ReadDouble().To(&value)) return MaybeDirectHandle<JSDate>();
@@ -2533,6 +2766,39 @@ static void CommitProperties(
   }
 }
 
+// Prepares the field |descriptor| of |target|, the last one of the map, to
+// hold |value|, generalizing its field type if needed. Returns false if the
+// value doesn't fit the field, in which case the property has to be defined
+// the slow way.
+static bool PrepareFieldForValue(Isolate* isolate, DirectHandle<Map>* target,
+                                 InternalIndex descriptor,
+                                 DirectHandle<Object> value) {
+  // Deserializaton of |value| might have deprecated current |target|, ensure
+  // we are working with the up-to-date version.
+  *target = Map::Update(isolate, *target);
+  if ((*target)->is_dictionary_map()) return false;
+  PropertyDetails details =
+      (*target)->instance_descriptors(isolate)->GetDetails(descriptor);
+  Representation expected_representation = details.representation();
+  if (!Object::FitsRepresentation(*value, expected_representation)) {
+    return false;
+  }
+  if (expected_representation.IsHeapObject() &&
+      !FieldType::NowContains(
+          (*target)->instance_descriptors(isolate)->GetFieldType(descriptor),
+          value)) {
+    DirectHandle<FieldType> value_type =
+        Object::OptimalType(*value, isolate, expected_representation);
+    MapUpdater::GeneralizeField(isolate, *target, descriptor,
+                                details.constness(), expected_representation,
+                                value_type);
+  }
+  DCHECK(FieldType::NowContains(
+      (*target)->instance_descriptors(isolate)->GetFieldType(descriptor),
+      value));
+  return true;
+}
+
 static bool IsValidObjectKey(Tagged<Object> value, Isolate* isolate) {
   if (IsSmi(value)) return true;
   auto instance_type = Cast<HeapObject>(value)->map(isolate)->instance_type();
@@ -2631,34 +2897,11 @@ Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
       // (though generalization may be required), store the property value so
       // that we can copy them all at once. Otherwise, stop transitioning.
       if (transitioning) {
-        // Deserializaton of |value| might have deprecated current |target|,
-        // ensure we are working with the up-to-date version.
-        target = Map::Update(isolate_, target);
-        if (!target->is_dictionary_map()) {
-          InternalIndex descriptor(properties.size());
-          PropertyDetails details =
-              target->instance_descriptors(isolate_)->GetDetails(descriptor);
-          Representation expected_representation = details.representation();
-          if (Object::FitsRepresentation(*value, expected_representation)) {
-            if (expected_representation.IsHeapObject() &&
-                !FieldType::NowContains(
-                    target->instance_descriptors(isolate_)->GetFieldType(
-                        descriptor),
-                    value)) {
-              DirectHandle<FieldType> value_type = Object::OptimalType(
-                  *value, isolate_, expected_representation);
-              MapUpdater::GeneralizeField(isolate_, target, descriptor,
-                                          details.constness(),
-                                          expected_representation, value_type);
-            }
-            DCHECK(FieldType::NowContains(
-                target->instance_descriptors(isolate_)->GetFieldType(
-                    descriptor),
-                value));
-            properties.push_back(value);
-            map = target;
-            continue;
-          }
+        if (PrepareFieldForValue(isolate_, &target,
+                                 InternalIndex(properties.size()), value)) {
+          properties.push_back(value);
+          map = target;
+          continue;
         }
         transitioning = false;
       }
@@ -2716,6 +2959,109 @@ Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
   }
 }
 
+MaybeDirectHandle<FixedArray> ValueDeserializer::ReadObjectShape(
+    uint32_t shape_id) {
+  if (shape_id < next_object_shape_id_) {
+    return direct_handle(Cast<FixedArray>(object_shapes_->get(shape_id)),
+                         isolate_);
+  }
+  // Shapes are numbered in the order they are first used.
+  if (shape_id != next_object_shape_id_) return MaybeDirectHandle<FixedArray>();
+
+  // Each key takes at least two bytes to encode.
+  uint32_t num_keys;
+  if (!ReadVarint<uint32_t>().To(&num_keys) || num_keys == 0 ||
+      num_keys > static_cast<uint32_t>(FixedArray::kMaxLength) ||
+      num_keys > static_cast<size_t>(end_ - position_) / 2) {
+    return MaybeDirectHandle<FixedArray>();
+  }
+  DirectHandle<FixedArray> keys = isolate_->factory()->NewFixedArray(num_keys);
+  for (uint32_t i = 0; i < num_keys; i++) {
+    DirectHandle<String> key;
+    if (!ReadString().ToHandle(&key)) return MaybeDirectHandle<FixedArray>();
+    key = isolate_->factory()->InternalizeString(key);
+    keys->set(i, *key);
+  }
+
+  DirectHandle<FixedArray> new_shapes =
+      FixedArray::SetAndGrow(isolate_, object_shapes_, shape_id, keys);
+  next_object_shape_id_++;
+
+  // If the array was reallocated, update the global handle.
+  if (!new_shapes.is_identical_to(object_shapes_)) {
+    GlobalHandles::Destroy(object_shapes_.location());
+    object_shapes_ = isolate_->global_handles()->Create(*new_shapes);
+  }
+  return keys;
+}
+
+MaybeDirectHandle<JSObject> ValueDeserializer::ReadShapedJSObject() {
+  // If we are at the end of the stack, abort. This function may recurse.
+  STACK_CHECK(isolate_, MaybeDirectHandle<JSObject>());
+
+  uint32_t id = next_id_++;
+  HandleScope scope(isolate_);
+  uint32_t shape_id;
+  DirectHandle<FixedArray> keys;
+  if (!ReadVarint<uint32_t>().To(&shape_id) ||
+      !ReadObjectShape(shape_id).ToHandle(&keys)) {
+    return MaybeDirectHandle<JSObject>();
+  }
+
+  DirectHandle<JSObject> object =
+      isolate_->factory()->NewJSObject(isolate_->object_function());
+  AddObjectWithID(id, object);
+
+  // Follow map transitions for as long as the values fit, and define the
+  // remaining properties the slow way, like ReadJSObjectProperties does.
+  bool transitioning = true;
+  DirectHandle<Map> map(object->map(), isolate_);
+  DirectHandleVector<Object> properties(isolate_);
+  properties.reserve(keys->length());
+  for (int i = 0; i < keys->length(); i++) {
+    SerializationTag tag;
+    if (!PeekTag().To(&tag)) return MaybeDirectHandle<JSObject>();
+    if (tag == SerializationTag::kTheHole) {
+      ConsumeTag(SerializationTag::kTheHole);
+      continue;
+    }
+
+    DirectHandle<String> key(Cast<String>(keys->get(i)), isolate_);
+    DirectHandle<Object> value;
+    if (!ReadObject().ToHandle(&value)) return MaybeDirectHandle<JSObject>();
+
+    if (transitioning) {
+      DirectHandle<Map> target;
+      if (TransitionsAccessor(isolate_, *map)
+              .FindTransitionToField(key)
+              .ToHandle(&target) &&
+          PrepareFieldForValue(isolate_, &target,
+                               InternalIndex(properties.size()), value)) {
+        properties.push_back(value);
+        map = target;
+        continue;
+      }
+      transitioning = false;
+      CHECK(!map->is_dictionary_map());
+      CommitProperties(isolate_, object, map, base::VectorOf(properties));
+    }
+
+    PropertyKey lookup_key(isolate_, key);
+    LookupIterator it(isolate_, object, lookup_key, LookupIterator::OWN);
+    if (it.state() != LookupIterator::NOT_FOUND ||
+        JSObject::DefineOwnPropertyIgnoreAttributes(&it, value, NONE)
+            .is_null()) {
+      return MaybeDirectHandle<JSObject>();
+    }
+  }
+  if (transitioning) {
+    CommitProperties(isolate_, object, map, base::VectorOf(properties));
+  }
+
+  DCHECK(HasObjectWithID(id));
+  return scope.CloseAndEscape(object);
+}
+
 bool ValueDeserializer::HasObjectWithID(uint32_t id) {
   return id < static_cast<unsigned>(id_map_->length()) &&
          !IsTheHole(id_map_->get(id), isolate_);
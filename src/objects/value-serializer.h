@@ -59,6 +59,13 @@ class ValueSerializer {
    */
   void WriteHeader();
 
+  /*
+   * Sets the format version to write, which defaults to an older version than
+   * the latest one. Returns false if the version can't be written. Must be
+   * called before anything is written.
+   */
+  V8_WARN_UNUSED_RESULT bool SetTargetVersion(uint32_t version);
+
   /*
    * Serializes a V8 object into the buffer.
    */
@@ -97,6 +104,12 @@ class ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /*
+   * Indicate whether to pass large strings through the shared object conveyor
+   * instead of copying them. Requires --shared-string-table and a delegate.
+   */
+  void SetShareStrings(bool mode);
+
  private:
   // Managing allocations of the internal buffer.
   Maybe<bool> ExpandBuffer(size_t required_capacity);
@@ -124,7 +137,11 @@ class ValueSerializer {
       V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSObjectSlow(DirectHandle<JSObject> object)
       V8_WARN_UNUSED_RESULT;
+  Maybe<bool> WriteShapedJSObject(DirectHandle<JSObject> object,
+                                  DirectHandle<Map> map) V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSArray(DirectHandle<JSArray> array) V8_WARN_UNUSED_RESULT;
+  void WriteDenseNumberJSArrayElements(DirectHandle<JSArray> array,
+                                       uint32_t length);
   void WriteJSDate(Tagged<JSDate> date);
   Maybe<bool> WriteJSPrimitiveWrapper(DirectHandle<JSPrimitiveWrapper> value)
       V8_WARN_UNUSED_RESULT;
@@ -147,6 +164,8 @@ class ValueSerializer {
 #endif  // V8_ENABLE_WEBASSEMBLY
   Maybe<bool> WriteSharedObject(DirectHandle<HeapObject> object)
       V8_WARN_UNUSED_RESULT;
+  Maybe<bool> WriteSharedString(DirectHandle<String> string)
+      V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteHostObject(DirectHandle<JSObject> object)
       V8_WARN_UNUSED_RESULT;
 
@@ -180,6 +199,7 @@ class ValueSerializer {
   size_t buffer_capacity_ = 0;
   bool has_custom_host_objects_ = false;
   bool treat_array_buffer_views_as_host_objects_ = false;
+  bool share_strings_ = false;
   bool out_of_memory_ = false;
   Zone zone_;
 
@@ -192,6 +212,14 @@ class ValueSerializer {
   // A similar map, for transferred array buffers.
   IdentityMap<uint32_t, ZoneAllocationPolicy> array_buffer_transfer_map_;
 
+  // Maps the maps of objects written with shapes to their shape IDs.
+  IdentityMap<uint32_t, ZoneAllocationPolicy> object_shape_map_;
+  uint32_t next_object_shape_id_ = 0;
+
+  // The format version written to the header. Encodings that were added in
+  // later versions aren't used.
+  uint32_t target_version_;
+
   // The conveyor used to keep shared objects alive.
   SharedObjectConveyorHandles* shared_object_conveyor_ = nullptr;
 };
@@ -292,6 +320,11 @@ class ValueDeserializer {
   MaybeDirectHandle<JSObject> ReadJSObject() V8_WARN_UNUSED_RESULT;
   MaybeDirectHandle<JSArray> ReadSparseJSArray() V8_WARN_UNUSED_RESULT;
   MaybeDirectHandle<JSArray> ReadDenseJSArray() V8_WARN_UNUSED_RESULT;
+  MaybeDirectHandle<JSArray> ReadDenseNumberJSArray(SerializationTag tag)
+      V8_WARN_UNUSED_RESULT;
+  MaybeDirectHandle<JSObject> ReadShapedJSObject() V8_WARN_UNUSED_RESULT;
+  MaybeDirectHandle<FixedArray> ReadObjectShape(uint32_t shape_id)
+      V8_WARN_UNUSED_RESULT;
   MaybeDirectHandle<JSDate> ReadJSDate() V8_WARN_UNUSED_RESULT;
   MaybeDirectHandle<JSPrimitiveWrapper> ReadJSPrimitiveWrapper(
       SerializationTag tag) V8_WARN_UNUSED_RESULT;
@@ -334,12 +367,15 @@ class ValueDeserializer {
   const uint8_t* const end_;
   uint32_t version_ = 0;
   uint32_t next_id_ = 0;
+  uint32_t next_object_shape_id_ = 0;
   bool version_13_broken_data_mode_ = false;
   bool suppress_deserialization_errors_ = false;
 
   // Always global handles.
   IndirectHandle<FixedArray> id_map_;
   MaybeIndirectHandle<SimpleNumberDictionary> array_buffer_transfer_map_;
+  // The keys of each object shape, indexed by shape ID.
+  IndirectHandle<FixedArray> object_shapes_;
 
   // The conveyor used to keep shared objects alive.
   const SharedObjectConveyorHandles* shared_object_conveyor_ = nullptr;
@@ -40,6 +40,8 @@ UnoptimizedCompileFlags::UnoptimizedCompileFlags(Isolate* isolate,
       v8_flags.parallel_compile_tasks_for_eager_toplevel);
   set_post_parallel_compile_tasks_for_lazy(
       v8_flags.parallel_compile_tasks_for_lazy);
+  set_post_parallel_compile_tasks_for_compile_hints(
+      v8_flags.parallel_compile_tasks_for_compile_hints);
 }
 
 // static
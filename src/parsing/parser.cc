@@ -2708,14 +2708,15 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
   // This is true if we get here through CreateDynamicFunction.
   bool params_need_validation = parameters_end_pos_ != kNoSourcePosition;
   int compile_hint_position = peek_position();
+  bool has_compile_hint =
+      (info()->flags().compile_hints_magic_enabled() &&
+       scanner()->SawMagicCommentCompileHintsAll()) ||
+      (info()->flags().compile_hints_per_function_magic_enabled() &&
+       scanner()->HasPerFunctionCompileHint(compile_hint_position));
 
   FunctionLiteral::EagerCompileHint eager_compile_hint =
       function_state_->next_function_is_likely_called() || is_wrapped ||
-              params_need_validation ||
-              (info()->flags().compile_hints_magic_enabled() &&
-               scanner()->SawMagicCommentCompileHintsAll()) ||
-              (info()->flags().compile_hints_per_function_magic_enabled() &&
-               scanner()->HasPerFunctionCompileHint(compile_hint_position))
+              params_need_validation || has_compile_hint
           ? FunctionLiteral::kShouldEagerCompile
           : default_eager_compile_hint();
 
@@ -2755,8 +2756,12 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
   DCHECK_IMPLIES(parse_lazily(), has_error() || allow_lazy_);
   DCHECK_IMPLIES(parse_lazily(), extension() == nullptr);
 
+  FunctionLiteral::EagerCompileHint hint_before_embedder = eager_compile_hint;
   eager_compile_hint =
       GetEmbedderCompileHint(eager_compile_hint, compile_hint_position);
+  has_compile_hint |=
+      hint_before_embedder == FunctionLiteral::kShouldLazyCompile &&
+      eager_compile_hint == FunctionLiteral::kShouldEagerCompile;
 
   const bool is_lazy =
       eager_compile_hint == FunctionLiteral::kShouldLazyCompile;
@@ -2781,12 +2786,16 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
       scanner()->stream()->can_be_cloned_for_parallel_access();
 
   // If parallel compile tasks are enabled, and this isn't a re-parse, enable
-  // parallel compile for the subset of functions as defined by flags.
+  // parallel compile for the subset of functions as defined by flags. Functions
+  // that are eager only because of a compile hint are compiled on worker
+  // threads instead of inline with the surrounding script.
   bool should_post_parallel_task =
       can_post_parallel_task && !flags().is_reparse() &&
       ((is_eager_top_level_function &&
         flags().post_parallel_compile_tasks_for_eager_toplevel()) ||
-       (is_lazy && flags().post_parallel_compile_tasks_for_lazy()));
+       (is_lazy && flags().post_parallel_compile_tasks_for_lazy()) ||
+       (!is_lazy && has_compile_hint &&
+        flags().post_parallel_compile_tasks_for_compile_hints()));
 
   // Determine whether we should lazy parse the inner function. This will be
   // when either the function is lazy by inspection, or when we force it to be
@@ -11,6 +11,7 @@
 #include "src/logging/log.h"
 #include "src/objects/objects-inl.h"
 #include "src/regexp/regexp-macro-assembler.h"
+#include "src/regexp/regexp-required-literals.h"
 #include "src/regexp/regexp-stack.h"
 #include "src/snapshot/embedded/embedded-data.h"
 #include "src/strings/unicode.h"
@@ -865,6 +866,40 @@ bool RegExpMacroAssemblerARM64::CheckSpecialClassRanges(
   }
 }
 
+bool RegExpMacroAssemblerARM64::CheckRequiredLiterals(
+    const ZoneList<base::Vector<const base::uc16>>* literals,
+    Label* on_found) {
+  CheckPosition(RegExpRequiredLiterals::MinSubjectLength(literals) - 1,
+                on_found);
+  if (global()) {
+    __ Ldr(w10, MemOperand(frame_pointer(), kSuccessfulCapturesOffset));
+    __ Cmp(w10, 0);
+    BranchOrBacktrack(ne, on_found);
+  }
+
+  // As for CallIsCharacterInRangeArray, x0 is a cached register and must be
+  // compared before it is popped.
+  PushCachedRegisters();
+  static const int kNumArguments = 4;
+  __ Mov(x0, MakeRequiredLiteralArray(literals));
+  __ Add(x1, input_end(), Operand(current_input_offset(), SXTW));
+  __ Mov(x2, input_end());
+  __ Mov(w3, mode_ == LATIN1 ? 1 : 0);
+
+  {
+    // We have a frame (set up in GetCode), but the assembler doesn't know.
+    FrameScope scope(masm_.get(), StackFrame::MANUAL);
+    CallCFunctionFromIrregexpCode(
+        ExternalReference::re_contains_required_literal(), kNumArguments);
+  }
+
+  __ Mov(code_pointer(), Operand(masm_->CodeObject()));
+  __ Cmp(x0, 0);
+  PopCachedRegisters();
+  BranchOrBacktrack(ne, on_found);
+  return true;
+}
+
 void RegExpMacroAssemblerARM64::Fail() {
   __ Mov(w0, FAILURE);
   __ B(&exit_label_);
@@ -67,6 +67,9 @@ class V8_EXPORT_PRIVATE RegExpMacroAssemblerARM64
   void CheckPosition(int cp_offset, Label* on_outside_input) override;
   bool CheckSpecialClassRanges(StandardCharacterSet type,
                                Label* on_no_match) override;
+  bool CheckRequiredLiterals(
+      const ZoneList<base::Vector<const base::uc16>>* literals,
+      Label* on_found) override;
   void BindJumpTarget(Label* label = nullptr) override;
   void Fail() override;
   DirectHandle<HeapObject> GetCode(DirectHandle<String> source,
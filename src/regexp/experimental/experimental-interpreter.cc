@@ -7,6 +7,7 @@
 #include "src/objects/string-inl.h"
 #include "src/regexp/experimental/experimental.h"
 #include "src/sandbox/check.h"
+#include "src/zone/zone-containers.h"
 
 namespace v8 {
 namespace internal {
@@ -237,6 +238,302 @@ class FilterGroups {
   base::Vector<const RegExpInstruction> bytecode_;
 };
 
+// A lazily built DFA over the bytecode of a regexp without assertions and
+// lookarounds, in the spirit of RE2's DFA.  A DFA state is the ordered list of
+// the NFA threads blocked on a CONSUME_RANGE or RANGE_COUNT instruction after
+// processing some input, i.e. the state of `NfaInterpreter::blocked_threads_`
+// without the registers.  States are computed on demand, by running the same
+// priority-ordered thread simulation as `NfaInterpreter`, and are cached
+// together with their transitions until the memory budget given by
+// `--experimental-regexp-engine-lazy-dfa-max-memory` is exhausted.
+//
+// The DFA only answers whether there is a match at all, and from which input
+// position the NFA can be restarted without changing the match it finds.
+// The latter are positions at which no thread that started matching at an
+// earlier position is alive: The NFA's threads at such a position are exactly
+// the threads of a fresh search started there, including their registers.
+// To know about this, every thread also records whether it has consumed a
+// character outside of the /.*?/ preamble (see experimental-compiler.cc).
+class LazyDfa {
+ public:
+  struct State {
+    // Encoded threads, see `EncodeThread`, sorted from high to low priority.
+    base::Vector<const uint32_t> threads;
+    // Whether a thread executed ACCEPT while computing this state.
+    bool is_match;
+    // Whether no thread that started matching before the current input
+    // position is alive or has accepted.
+    bool is_restart_point;
+    // Successor states, indexed by character class.  Null if not computed
+    // yet.
+    State** next;
+  };
+
+  LazyDfa(base::Vector<const RegExpInstruction> bytecode, Zone* zone)
+      : bytecode_(bytecode),
+        visited_(zone->AllocateArray<uint32_t>(2 * bytecode.length()),
+                 2 * bytecode.length()),
+        states_(zone),
+        class_boundaries_(zone),
+        stack_(zone),
+        threads_(zone),
+        zone_(zone) {
+    std::fill(visited_.begin(), visited_.end(), 0);
+
+    // The preamble ends where the match starts, i.e. at the first
+    // SET_REGISTER_TO_CP for register 0.  Character classes are delimited by
+    // the bounds of all ranges in the bytecode.
+    preamble_end_ = bytecode.length();
+    for (int i = 0; i < bytecode.length(); ++i) {
+      const RegExpInstruction& inst = bytecode[i];
+      if (inst.opcode == RegExpInstruction::SET_REGISTER_TO_CP &&
+          inst.payload.register_index == 0) {
+        preamble_end_ = std::min(preamble_end_, i);
+      }
+      if (inst.opcode == RegExpInstruction::CONSUME_RANGE) {
+        class_boundaries_.push_back(inst.payload.consume_range.min);
+        class_boundaries_.push_back(inst.payload.consume_range.max + 1);
+      }
+    }
+    std::sort(class_boundaries_.begin(), class_boundaries_.end());
+    class_boundaries_.erase(
+        std::unique(class_boundaries_.begin(), class_boundaries_.end()),
+        class_boundaries_.end());
+    class_count_ = static_cast<int>(class_boundaries_.size()) + 1;
+    for (int c = 0; c < kOneByteClassTableSize; ++c) {
+      one_byte_classes_[c] = ComputeCharacterClass(c);
+    }
+  }
+
+  // Returns whether the DFA can be used for `bytecode`.
+  static bool CanHandle(base::Vector<const RegExpInstruction> bytecode) {
+    for (const RegExpInstruction& inst : bytecode) {
+      switch (inst.opcode) {
+        case RegExpInstruction::ASSERTION:
+        case RegExpInstruction::START_LOOKAROUND:
+        case RegExpInstruction::END_LOOKAROUND:
+        case RegExpInstruction::WRITE_LOOKAROUND_TABLE:
+        case RegExpInstruction::READ_LOOKAROUND_TABLE:
+          return false;
+        default:
+          break;
+      }
+    }
+    return true;
+  }
+
+  // The bytecode may move during garbage collection.
+  void UpdateBytecode(base::Vector<const RegExpInstruction> bytecode) {
+    DCHECK_EQ(bytecode.length(), bytecode_.length());
+    bytecode_ = bytecode;
+  }
+
+  // Returns the state before consuming any input, or null if the memory budget
+  // is exhausted.
+  State* Start() {
+    if (start_ == nullptr) {
+      threads_.clear();
+      stack_.clear();
+      stack_.push_back(EncodeThread(0, true, false));
+      start_ = ComputeState();
+    }
+    return start_;
+  }
+
+  // Returns the state after consuming `c` in `state`, or null if the memory
+  // budget is exhausted.
+  State* Next(State* state, base::uc16 c) {
+    int character_class = c < kOneByteClassTableSize
+                              ? one_byte_classes_[c]
+                              : ComputeCharacterClass(c);
+    State* next = state->next[character_class];
+    if (next != nullptr) return next;
+
+    // Threads blocked on a range containing `c` advance past their ranges.
+    // They are pushed so that the highest priority thread is run first.
+    threads_.clear();
+    stack_.clear();
+    for (int i = state->threads.length() - 1; i >= 0; --i) {
+      uint32_t thread = state->threads[i];
+      int pc = ThreadPc(thread);
+      bool started_earlier =
+          ThreadStartedEarlier(thread) || pc >= preamble_end_;
+      int ranges = 1;
+      if (bytecode_[pc].opcode == RegExpInstruction::RANGE_COUNT) {
+        ranges = bytecode_[pc].payload.num_ranges;
+        ++pc;
+      }
+      for (int range_pc = pc; range_pc < pc + ranges; ++range_pc) {
+        RegExpInstruction::Uc16Range range =
+            bytecode_[range_pc].payload.consume_range;
+        if (c >= range.min && c <= range.max) {
+          stack_.push_back(EncodeThread(pc + ranges, true, started_earlier));
+          break;
+        }
+      }
+    }
+
+    next = ComputeState();
+    if (next != nullptr) state->next[character_class] = next;
+    return next;
+  }
+
+  static bool IsDead(const State* state) {
+    return state->threads.empty() && !state->is_match;
+  }
+
+ private:
+  static constexpr int kOneByteClassTableSize = 256;
+
+  static uint32_t EncodeThread(int pc, bool consumed_since_last_quantifier,
+                               bool started_earlier) {
+    return (static_cast<uint32_t>(pc) << 2) |
+           (consumed_since_last_quantifier ? 2 : 0) | (started_earlier ? 1 : 0);
+  }
+  static int ThreadPc(uint32_t thread) { return thread >> 2; }
+  static bool ThreadConsumed(uint32_t thread) { return thread & 2; }
+  static bool ThreadStartedEarlier(uint32_t thread) { return thread & 1; }
+
+  int ComputeCharacterClass(base::uc16 c) const {
+    return static_cast<int>(std::upper_bound(class_boundaries_.begin(),
+                                             class_boundaries_.end(), c) -
+                            class_boundaries_.begin());
+  }
+
+  // Runs the threads on `stack_` (the last one has the highest priority) until
+  // they block or accept, mirroring `NfaInterpreter::RunActiveThreads`, and
+  // returns the cached state for the resulting blocked threads.
+  State* ComputeState() {
+    if (++generation_ == 0) {
+      std::fill(visited_.begin(), visited_.end(), 0);
+      generation_ = 1;
+    }
+    bool is_match = false;
+    bool has_earlier_thread = false;
+    while (!stack_.empty()) {
+      uint32_t thread = stack_.back();
+      stack_.pop_back();
+      int pc = ThreadPc(thread);
+      bool consumed = ThreadConsumed(thread);
+      const bool started_earlier = ThreadStartedEarlier(thread);
+      bool blocked_or_dead = false;
+      while (!blocked_or_dead) {
+        uint32_t& visited = visited_[2 * pc + (consumed ? 1 : 0)];
+        if (visited == generation_) break;
+        visited = generation_;
+
+        const RegExpInstruction& inst = bytecode_[pc];
+        switch (inst.opcode) {
+          case RegExpInstruction::CONSUME_RANGE:
+          case RegExpInstruction::RANGE_COUNT:
+            threads_.push_back(EncodeThread(pc, consumed, started_earlier));
+            has_earlier_thread |= started_earlier;
+            blocked_or_dead = true;
+            break;
+          case RegExpInstruction::FORK:
+            stack_.push_back(
+                EncodeThread(inst.payload.pc, consumed, started_earlier));
+            ++pc;
+            break;
+          case RegExpInstruction::JMP:
+            pc = inst.payload.pc;
+            break;
+          case RegExpInstruction::ACCEPT:
+            // Threads with lower priority can only produce worse matches.
+            is_match = true;
+            has_earlier_thread |= started_earlier;
+            stack_.clear();
+            blocked_or_dead = true;
+            break;
+          case RegExpInstruction::BEGIN_LOOP:
+            consumed = false;
+            ++pc;
+            break;
+          case RegExpInstruction::END_LOOP:
+            if (!consumed) {
+              blocked_or_dead = true;
+            } else {
+              ++pc;
+            }
+            break;
+          case RegExpInstruction::SET_QUANTIFIER_TO_CLOCK:
+          case RegExpInstruction::CLEAR_REGISTER:
+          case RegExpInstruction::SET_REGISTER_TO_CP:
+            ++pc;
+            break;
+          default:
+            UNREACHABLE();
+        }
+      }
+    }
+    return LookupOrInsertState(is_match, !has_earlier_thread);
+  }
+
+  State* LookupOrInsertState(bool is_match, bool is_restart_point) {
+    // The key is the list of threads followed by the state's flags.  It is
+    // built in `threads_`, and only copied into the zone for new states.
+    threads_.push_back((is_match ? 2 : 0) | (is_restart_point ? 1 : 0));
+    base::Vector<const uint32_t> key = base::VectorOf(threads_);
+    auto it = states_.find(key);
+    if (it != states_.end()) return it->second;
+
+    size_t state_size = sizeof(State) + key.size() * sizeof(uint32_t) +
+                        class_count_ * sizeof(State*) +
+                        kApproximateMapNodeSize;
+    if (memory_usage_ + state_size >
+        v8_flags.experimental_regexp_engine_lazy_dfa_max_memory * KB) {
+      return nullptr;
+    }
+    memory_usage_ += state_size;
+
+    uint32_t* key_copy = zone_->AllocateArray<uint32_t>(key.size());
+    std::copy(key.begin(), key.end(), key_copy);
+    State* state = zone_->New<State>();
+    // The threads are not stored twice, but point into the map's key.
+    state->threads = base::Vector<const uint32_t>(key_copy, key.size() - 1);
+    state->is_match = is_match;
+    state->is_restart_point = is_restart_point;
+    state->next = zone_->AllocateArray<State*>(class_count_);
+    std::fill_n(state->next, class_count_, nullptr);
+    states_.emplace(base::Vector<const uint32_t>(key_copy, key.size()), state);
+    return state;
+  }
+
+  struct KeyLess {
+    bool operator()(base::Vector<const uint32_t> a,
+                    base::Vector<const uint32_t> b) const {
+      return std::lexicographical_compare(a.begin(), a.end(), b.begin(),
+                                          b.end());
+    }
+  };
+
+  static constexpr size_t kApproximateMapNodeSize = 64;
+
+  base::Vector<const RegExpInstruction> bytecode_;
+  int preamble_end_;
+
+  // visited_[2 * pc + consumed] is the generation in which a thread at `pc`
+  // was last run, see `NfaInterpreter::IsPcProcessed`.
+  base::Vector<uint32_t> visited_;
+  uint32_t generation_ = 0;
+
+  ZoneMap<base::Vector<const uint32_t>, State*, KeyLess> states_;
+  State* start_ = nullptr;
+  size_t memory_usage_ = 0;
+
+  // Sorted, distinct first characters of each character class but the first.
+  // Can contain 0x10000 as the end of a range ending at 0xFFFF.
+  ZoneVector<int> class_boundaries_;
+  int class_count_;
+  int one_byte_classes_[kOneByteClassTableSize];
+
+  // Scratch space for `ComputeState`.
+  ZoneVector<uint32_t> stack_;
+  ZoneVector<uint32_t> threads_;
+
+  Zone* zone_;
+};
+
 template <class Character>
 class NfaInterpreter {
   // Executes a bytecode program in breadth-first mode, without backtracking.
@@ -466,6 +763,11 @@ class NfaInterpreter {
 
     std::fill(pc_last_input_index_.begin(), pc_last_input_index_.end(),
               LastInputIndex());
+
+    if (v8_flags.experimental_regexp_engine_lazy_dfa &&
+        LazyDfa::CanHandle(bytecode_)) {
+      lazy_dfa_.emplace(bytecode_, zone_);
+    }
   }
 
   // Finds matches and writes their concatenated capture registers to
@@ -714,7 +1016,6 @@ class NfaInterpreter {
         ++input_index_;
       }
 
-      static constexpr int kTicksBetweenInterruptHandling = 64;
       if (input_index_ % kTicksBetweenInterruptHandling == 0) {
         int err_code = HandleInterrupts();
         if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
@@ -789,6 +1090,7 @@ class NfaInterpreter {
         bytecode_ = ToInstructionVector(bytecode_object_, no_gc_);
         input_object_ = *input_handle;
         input_ = ToCharacterVector<Character>(input_object_, no_gc_);
+        if (lazy_dfa_.has_value()) lazy_dfa_->UpdateBytecode(bytecode_);
       }
     }
     return RegExp::kInternalRegExpSuccess;
@@ -840,6 +1142,13 @@ class NfaInterpreter {
       best_match_thread_ = std::nullopt;
     }
 
+    if (lazy_dfa_.has_value()) {
+      bool has_match;
+      int err_code = RunLazyDfa(&has_match);
+      if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+      if (!has_match) return RegExp::kInternalRegExpSuccess;
+    }
+
     active_threads_.Add(NewEmptyThread(0), zone_);
 
     if (only_captureless_lookbehinds_) {
@@ -856,6 +1165,45 @@ class NfaInterpreter {
     return RegExp::kInternalRegExpSuccess;
   }
 
+  // Runs the lazy DFA from `input_index_` and sets `has_match` to whether
+  // there is a match.  If there is one, `input_index_` is advanced to the last
+  // position before the match at which the NFA can be restarted, so that the
+  // NFA only runs over the match to compute its capture registers.  If the
+  // memory budget of the DFA is exhausted, the DFA is discarded and
+  // `has_match` is set to true, leaving the search to the NFA.
+  V8_WARN_UNUSED_RESULT int RunLazyDfa(bool* has_match) {
+    DCHECK(lazy_dfa_.has_value());
+    DCHECK(!reverse_);
+    *has_match = true;
+
+    int index = input_index_;
+    int restart_index = input_index_;
+    LazyDfa::State* state = lazy_dfa_->Start();
+    while (state != nullptr) {
+      if (state->is_restart_point) restart_index = index;
+      if (state->is_match) {
+        SetInputIndex(restart_index);
+        return RegExp::kInternalRegExpSuccess;
+      }
+      if (LazyDfa::IsDead(state) || index == input_.length()) {
+        *has_match = false;
+        return RegExp::kInternalRegExpSuccess;
+      }
+
+      base::uc16 input_char = input_[index++];
+
+      if (index % kTicksBetweenInterruptHandling == 0) {
+        int err_code = HandleInterrupts();
+        if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+      }
+
+      state = lazy_dfa_->Next(state, input_char);
+    }
+
+    lazy_dfa_.reset();
+    return RegExp::kInternalRegExpSuccess;
+  }
+
   // Run an active thread `t` until it executes a CONSUME_RANGE or ACCEPT
   // or RANGE_COUNT instruction, or its PC value was already processed.
   // - If processing of `t` can't continue because of CONSUME_RANGE or
@@ -1431,6 +1779,8 @@ class NfaInterpreter {
     }
   }
 
+  static constexpr int kTicksBetweenInterruptHandling = 64;
+
   Isolate* const isolate_;
 
   const RegExp::CallOrigin call_origin_;
@@ -1542,6 +1892,11 @@ class NfaInterpreter {
 
   uint64_t memory_consumption_per_thread_;
 
+  // Finds out whether there is a match before running the NFA. Only present
+  // if the bytecode can be handled by the DFA and its memory budget was not
+  // exhausted.
+  std::optional<LazyDfa> lazy_dfa_;
+
   Zone* zone_;
 };
 
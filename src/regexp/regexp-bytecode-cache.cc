@@ -0,0 +1,88 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-bytecode-cache.h"
+
+#include "src/base/hashing.h"
+#include "src/flags/flags.h"
+#include "src/objects/string-inl.h"
+
+namespace v8::internal {
+
+RegExpBytecodeCache::Entry::Entry(base::Vector<const uint8_t> bytecode,
+                                  int register_count, uint32_t backtrack_limit)
+    : bytecode(base::OwnedCopyOf(bytecode)),
+      register_count(register_count),
+      backtrack_limit(backtrack_limit) {}
+
+size_t RegExpBytecodeCache::KeyHash::operator()(const Key& key) const {
+  return base::Hasher{}
+      .AddRange(key.pattern.begin(), key.pattern.end())
+      .Add(key.flags)
+      .Add(key.is_one_byte)
+      .Add(key.backtrack_limit)
+      .Add(key.flag_hash)
+      .hash();
+}
+
+// static
+RegExpBytecodeCache::Key RegExpBytecodeCache::MakeKey(
+    Tagged<String> pattern, RegExpFlags flags, bool is_one_byte,
+    uint32_t backtrack_limit) {
+  DCHECK(pattern->IsFlat());
+  std::vector<base::uc16> chars(pattern->length());
+  String::WriteToFlat(pattern, chars.data(), 0, pattern->length());
+  return Key{std::move(chars), static_cast<int>(flags), is_one_byte,
+             backtrack_limit, FlagList::Hash()};
+}
+
+std::shared_ptr<const RegExpBytecodeCache::Entry> RegExpBytecodeCache::Lookup(
+    Tagged<String> pattern, RegExpFlags flags, bool is_one_byte,
+    uint32_t backtrack_limit) {
+  Key key = MakeKey(pattern, flags, is_one_byte, backtrack_limit);
+  base::MutexGuard guard(&mutex_);
+  auto it = map_.find(key);
+  if (it == map_.end()) return nullptr;
+  entries_.splice(entries_.begin(), entries_, it->second);
+  return it->second->second;
+}
+
+void RegExpBytecodeCache::Insert(Tagged<String> pattern, RegExpFlags flags,
+                                 bool is_one_byte, uint32_t backtrack_limit,
+                                 std::shared_ptr<const Entry> entry) {
+  const size_t entry_size = entry->bytecode.size();
+  if (entry_size > max_size_) return;
+  Key key = MakeKey(pattern, flags, is_one_byte, backtrack_limit);
+  base::MutexGuard guard(&mutex_);
+  // Another isolate may have compiled the same regexp concurrently.
+  if (map_.contains(key)) return;
+  entries_.emplace_front(key, std::move(entry));
+  map_.emplace(std::move(key), entries_.begin());
+  size_ += entry_size;
+  EvictLocked();
+}
+
+void RegExpBytecodeCache::EvictLocked() {
+  while (size_ > max_size_) {
+    DCHECK(!entries_.empty());
+    auto& [key, entry] = entries_.back();
+    size_ -= entry->bytecode.size();
+    map_.erase(key);
+    entries_.pop_back();
+  }
+}
+
+void RegExpBytecodeCache::Clear() {
+  base::MutexGuard guard(&mutex_);
+  map_.clear();
+  entries_.clear();
+  size_ = 0;
+}
+
+size_t RegExpBytecodeCache::size_for_testing() {
+  base::MutexGuard guard(&mutex_);
+  return size_;
+}
+
+}  // namespace v8::internal
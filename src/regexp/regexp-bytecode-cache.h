@@ -0,0 +1,92 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+#define V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "src/base/platform/mutex.h"
+#include "src/base/strings.h"
+#include "src/base/vector.h"
+#include "src/objects/tagged.h"
+#include "src/regexp/regexp-flags.h"
+
+namespace v8::internal {
+
+class String;
+
+// A cache of irregexp bytecode shared by all isolates of an IsolateGroup, so
+// that regexps compiled by one isolate start warm in the others. Bytecode
+// doesn't refer to heap objects or isolate-specific addresses, so installing a
+// cached regexp is a copy into a new TrustedByteArray. Native code can't be
+// shared like this; it embeds addresses of the compiling isolate.
+//
+// Entries are reference counted, so that a lookup can copy the bytecode
+// without holding the lock, and evicted in least recently used order once the
+// bytecode exceeds the size limit. All methods are thread-safe.
+class RegExpBytecodeCache final {
+ public:
+  struct Entry {
+    Entry(base::Vector<const uint8_t> bytecode, int register_count,
+          uint32_t backtrack_limit);
+
+    const base::OwnedVector<uint8_t> bytecode;
+    const int register_count;
+    // The backtrack limit after compilation, which may have been lowered to
+    // fall back to the experimental engine.
+    const uint32_t backtrack_limit;
+  };
+
+  explicit RegExpBytecodeCache(size_t max_size) : max_size_(max_size) {}
+  RegExpBytecodeCache(const RegExpBytecodeCache&) = delete;
+  RegExpBytecodeCache& operator=(const RegExpBytecodeCache&) = delete;
+
+  // `pattern` must be flat. The backtrack limit is the one the regexp was
+  // created with.
+  std::shared_ptr<const Entry> Lookup(Tagged<String> pattern, RegExpFlags flags,
+                                      bool is_one_byte,
+                                      uint32_t backtrack_limit);
+  void Insert(Tagged<String> pattern, RegExpFlags flags, bool is_one_byte,
+              uint32_t backtrack_limit, std::shared_ptr<const Entry> entry);
+
+  void Clear();
+  size_t size_for_testing();
+
+ private:
+  struct Key {
+    std::vector<base::uc16> pattern;
+    int flags;
+    bool is_one_byte;
+    uint32_t backtrack_limit;
+    // Bytecode generation depends on flags, e.g. the peephole optimization.
+    uint32_t flag_hash;
+
+    bool operator==(const Key& other) const = default;
+  };
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+  using EntryList = std::list<std::pair<Key, std::shared_ptr<const Entry>>>;
+
+  static Key MakeKey(Tagged<String> pattern, RegExpFlags flags,
+                     bool is_one_byte, uint32_t backtrack_limit);
+
+  void EvictLocked();
+
+  base::Mutex mutex_;
+  // Most recently used entries first.
+  EntryList entries_;
+  std::unordered_map<Key, EntryList::iterator, KeyHash> map_;
+  // The total size of the cached bytecode.
+  size_t size_ = 0;
+  const size_t max_size_;
+};
+
+}  // namespace v8::internal
+
+#endif  // V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
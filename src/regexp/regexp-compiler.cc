@@ -255,7 +255,8 @@ RegExpCompiler::RegExpCompiler(Isolate* isolate, Zone* zone, int capture_count,
       current_expansion_factor_(1),
       frequency_collator_(),
       isolate_(isolate),
-      zone_(zone) {
+      zone_(zone),
+      stack_limit_(isolate->stack_guard()->real_climit()) {
   accept_ = zone->New<EndNode>(EndNode::ACCEPT, zone);
   DCHECK_GE(RegExpMacroAssembler::kMaxRegister, next_register_ - 1);
 }
@@ -3795,15 +3796,16 @@ class EatsAtLeastPropagator : public AllStatic {
 template <typename... Propagators>
 class Analysis : public NodeVisitor {
  public:
-  Analysis(Isolate* isolate, bool is_one_byte, RegExpFlags flags)
+  Analysis(Isolate* isolate, bool is_one_byte, RegExpFlags flags,
+           uintptr_t stack_limit)
       : isolate_(isolate),
         is_one_byte_(is_one_byte),
         flags_(flags),
+        stack_limit_(stack_limit),
         error_(RegExpError::kNone) {}
 
   void EnsureAnalyzed(RegExpNode* that) {
-    StackLimitCheck check(isolate());
-    if (check.HasOverflowed()) {
+    if (GetCurrentStackPosition() < stack_limit_) {
       if (v8_flags.correctness_fuzzer_suppressions) {
         FATAL("Analysis: Aborting on stack overflow");
       }
@@ -3927,15 +3929,16 @@ class Analysis : public NodeVisitor {
   Isolate* isolate_;
   const bool is_one_byte_;
   RegExpFlags flags_;
+  const uintptr_t stack_limit_;
   RegExpError error_;
 
   DISALLOW_IMPLICIT_CONSTRUCTORS(Analysis);
 };
 
 RegExpError AnalyzeRegExp(Isolate* isolate, bool is_one_byte, RegExpFlags flags,
-                          RegExpNode* node) {
+                          RegExpNode* node, uintptr_t stack_limit) {
   Analysis<AssertionPropagator, EatsAtLeastPropagator> analysis(
-      isolate, is_one_byte, flags);
+      isolate, is_one_byte, flags, stack_limit);
   DCHECK_EQ(node->info()->been_analyzed, false);
   analysis.EnsureAnalyzed(node);
   DCHECK_IMPLIES(analysis.has_failed(), analysis.error() != RegExpError::kNone);
@@ -4102,7 +4105,7 @@ RegExpNode* RegExpCompiler::PreprocessRegExp(RegExpCompileData* data,
 }
 
 void RegExpCompiler::ToNodeCheckForStackOverflow() {
-  if (StackLimitCheck{isolate()}.HasOverflowed()) {
+  if (GetCurrentStackPosition() < stack_limit_) {
     V8::FatalProcessOutOfMemory(isolate(), "RegExpCompiler");
   }
 }
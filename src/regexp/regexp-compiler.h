@@ -411,9 +411,9 @@ struct PreloadState {
 
 // Analysis performs assertion propagation and computes eats_at_least_ values.
 // See the comments on AssertionPropagator and EatsAtLeastPropagator for more
-// details.
+// details. `stack_limit` is the limit of the current thread's stack.
 RegExpError AnalyzeRegExp(Isolate* isolate, bool is_one_byte, RegExpFlags flags,
-                          RegExpNode* node);
+                          RegExpNode* node, uintptr_t stack_limit);
 
 class FrequencyCollator {
  public:
@@ -580,6 +580,10 @@ class RegExpCompiler {
   }
   void ToNodeCheckForStackOverflow();
 
+  // The stack limit for the overflow checks above, which defaults to the
+  // isolate's. Compilation on a background thread has to pass its own.
+  void set_stack_limit(uintptr_t stack_limit) { stack_limit_ = stack_limit; }
+
   Isolate* isolate() const { return isolate_; }
   Zone* zone() const { return zone_; }
 
@@ -604,6 +608,7 @@ class RegExpCompiler {
   FrequencyCollator frequency_collator_;
   Isolate* isolate_;
   Zone* zone_;
+  uintptr_t stack_limit_;
 };
 
 // Categorizes character ranges into BMP, non-BMP, lead, and trail surrogates.
@@ -0,0 +1,171 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-concurrent-compiler.h"
+
+#include <algorithm>
+
+#include "src/execution/isolate.h"
+#include "src/handles/global-handles-inl.h"
+#include "src/init/v8.h"
+#include "src/objects/js-regexp-inl.h"
+#include "src/objects/string-inl.h"
+#include "src/regexp/regexp-parser.h"
+
+namespace v8::internal {
+
+class RegExpConcurrentCompiler::CompileTask final : public CancelableTask {
+ public:
+  CompileTask(Isolate* isolate, Job* job)
+      : CancelableTask(isolate), job_(job) {}
+
+  // The job outlives the task: Jobs are only deleted on the main thread once
+  // they have finished, after the task has been aborted, or after the
+  // isolate's tasks have been cancelled.
+  void RunInternal() override {
+    // Overflow checks in the front end use the limit of this thread's stack.
+    job_->Run(GetCurrentStackPosition() - v8_flags.stack_size * KB);
+  }
+
+ private:
+  Job* const job_;
+};
+
+RegExpConcurrentCompiler::Job::Job(Isolate* isolate,
+                                   DirectHandle<IrRegExpData> re_data,
+                                   bool is_one_byte)
+    : isolate_(isolate),
+      re_data_(isolate->global_handles()->Create(*re_data)),
+      flags_(JSRegExp::AsRegExpFlags(re_data->flags())),
+      is_one_byte_(is_one_byte),
+      zone_(isolate->allocator(), ZONE_NAME) {
+  // The worker thread can't access the heap, so it parses a copy of the
+  // pattern.
+  Tagged<String> source = re_data->source();
+  pattern_ = base::OwnedVector<base::uc16>::NewForOverwrite(source->length());
+  String::WriteToFlat(source, pattern_.begin(), 0, source->length());
+  compiler_.emplace(isolate, &zone_, re_data->capture_count(), flags_,
+                    is_one_byte);
+  compile_data_.compilation_target = RegExpCompilationTarget::kNative;
+}
+
+RegExpConcurrentCompiler::Job::~Job() {
+  GlobalHandles::Destroy(re_data_.location());
+}
+
+void RegExpConcurrentCompiler::Job::Run(uintptr_t stack_limit) {
+  DCHECK(!IsFinished());
+  RunFrontEnd(stack_limit);
+  // Once the job is observed as finished, the main thread may delete it, so
+  // keep the semaphore alive for waking up a waiting main thread.
+  std::shared_ptr<base::Semaphore> finished_signal = finished_signal_;
+  finished_.store(true, std::memory_order_release);
+  finished_signal->Signal();
+}
+
+void RegExpConcurrentCompiler::Job::RunOrWait() {
+  if (IsFinished()) return;
+  if (isolate_->cancelable_task_manager()->TryAbort(task_id_) ==
+      TryAbortResult::kTaskAborted) {
+    Run(isolate_->stack_guard()->real_climit());
+    return;
+  }
+  finished_signal_->Wait();
+  DCHECK(IsFinished());
+}
+
+void RegExpConcurrentCompiler::Job::RunFrontEnd(uintptr_t stack_limit) {
+  DisallowGarbageCollection no_gc;
+  RegExpCompiler* compiler = &compiler_.value();
+  compiler->set_stack_limit(stack_limit);
+  if (!RegExpParser::VerifyRegExpSyntax(&zone_, stack_limit, pattern_.begin(),
+                                        static_cast<int>(pattern_.size()),
+                                        flags_, &compile_data_, no_gc)) {
+    DCHECK_NE(compile_data_.error, RegExpError::kNone);
+    return;
+  }
+  compile_data_.node = compiler->PreprocessRegExp(&compile_data_, is_one_byte_);
+  if (compile_data_.error != RegExpError::kNone) return;
+  compile_data_.error = AnalyzeRegExp(isolate_, is_one_byte_, flags_,
+                                      compile_data_.node, stack_limit);
+}
+
+RegExpConcurrentCompiler::RegExpConcurrentCompiler(Isolate* isolate)
+    : isolate_(isolate) {}
+
+RegExpConcurrentCompiler::~RegExpConcurrentCompiler() = default;
+
+// static
+bool RegExpConcurrentCompiler::CanCompileConcurrently(Tagged<String> pattern,
+                                                      RegExpFlags flags) {
+  if (IsIgnoreCase(flags)) return false;
+  // Modifiers like (?i:...) may enable case-insensitivity for a group. This
+  // also rejects some patterns that merely contain these characters.
+  DCHECK(pattern->IsFlat());
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = pattern->GetFlatContent(no_gc);
+  const uint32_t length = pattern->length();
+  for (uint32_t i = 0; i + 2 < length; i++) {
+    if (content.Get(i) != '(' || content.Get(i + 1) != '?') continue;
+    const base::uc16 c = content.Get(i + 2);
+    if (c == 'i' || c == 'm' || c == 's' || c == '-') return false;
+  }
+  return true;
+}
+
+RegExpConcurrentCompiler::Job* RegExpConcurrentCompiler::FindJob(
+    Tagged<IrRegExpData> re_data) const {
+  for (const std::unique_ptr<Job>& job : jobs_) {
+    if (job->IsFor(re_data)) return job.get();
+  }
+  return nullptr;
+}
+
+bool RegExpConcurrentCompiler::HasJob(Tagged<IrRegExpData> re_data) const {
+  return FindJob(re_data) != nullptr;
+}
+
+bool RegExpConcurrentCompiler::StartJob(std::unique_ptr<Job> job) {
+  if (jobs_.size() >= kMaxJobs) {
+    // Drop finished jobs whose regexps haven't run again since. They tier up
+    // synchronously on their next execution instead.
+    std::erase_if(jobs_, [](const std::unique_ptr<Job>& job) {
+      if (!job->IsFinished()) return false;
+      Tagged<IrRegExpData> re_data = *job->re_data();
+      if (re_data->TierUpInProgress()) re_data->MarkTierUpForNextExec();
+      return true;
+    });
+    if (jobs_.size() >= kMaxJobs) return false;
+  }
+  auto task = std::make_unique<CompileTask>(isolate_, job.get());
+  job->set_task_id(task->id());
+  V8::GetCurrentPlatform()->PostTaskOnWorkerThread(TaskPriority::kUserVisible,
+                                                   std::move(task));
+  jobs_.push_back(std::move(job));
+  return true;
+}
+
+bool RegExpConcurrentCompiler::IsJobFinished(
+    Tagged<IrRegExpData> re_data) const {
+  Job* job = FindJob(re_data);
+  return job != nullptr && job->IsFinished();
+}
+
+std::unique_ptr<RegExpConcurrentCompiler::Job>
+RegExpConcurrentCompiler::TakeFinishedJob(Tagged<IrRegExpData> re_data) {
+  auto it = std::find_if(jobs_.begin(), jobs_.end(),
+                         [&](const std::unique_ptr<Job>& job) {
+                           return job->IsFor(re_data);
+                         });
+  if (it == jobs_.end() || !(*it)->IsFinished()) return nullptr;
+  std::unique_ptr<Job> job = std::move(*it);
+  jobs_.erase(it);
+  return job;
+}
+
+void RegExpConcurrentCompiler::FinishAllJobsForTesting() {
+  for (const std::unique_ptr<Job>& job : jobs_) job->RunOrWait();
+}
+
+}  // namespace v8::internal
@@ -0,0 +1,122 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_CONCURRENT_COMPILER_H_
+#define V8_REGEXP_REGEXP_CONCURRENT_COMPILER_H_
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "src/base/platform/semaphore.h"
+#include "src/base/vector.h"
+#include "src/handles/handles.h"
+#include "src/regexp/regexp-compiler.h"
+#include "src/regexp/regexp.h"
+#include "src/tasks/cancelable-task.h"
+#include "src/zone/zone.h"
+
+namespace v8::internal {
+
+class IrRegExpData;
+
+// Tier-up compilation of irregexp code in the background: The front end
+// (parsing, node graph construction and analysis) runs on a worker thread
+// while the regexp keeps being interpreted. Code generation allocates on the
+// heap and therefore runs on the main thread, the next time the regexp is
+// executed after the job has finished (see RegExpImpl::EnsureCompiledIrregexp).
+class RegExpConcurrentCompiler final {
+ public:
+  class Job;
+
+  explicit RegExpConcurrentCompiler(Isolate* isolate);
+  ~RegExpConcurrentCompiler();
+  RegExpConcurrentCompiler(const RegExpConcurrentCompiler&) = delete;
+  RegExpConcurrentCompiler& operator=(const RegExpConcurrentCompiler&) = delete;
+
+  // Whether the front end can run off the main thread. Case-insensitive
+  // patterns can't, since case folding uses per-isolate caches. `pattern` must
+  // be flat.
+  static bool CanCompileConcurrently(Tagged<String> pattern, RegExpFlags flags);
+
+  // Returns whether a job for `re_data` exists.
+  bool HasJob(Tagged<IrRegExpData> re_data) const;
+
+  // Posts `job` to a worker thread. Returns false if there are too many
+  // jobs already, in which case the caller should compile synchronously.
+  bool StartJob(std::unique_ptr<Job> job);
+
+  // Returns whether the job for `re_data` has finished. Doesn't dereference
+  // handles, so that it can be called from generated code.
+  bool IsJobFinished(Tagged<IrRegExpData> re_data) const;
+
+  // Removes and returns the job for `re_data` if it has finished, or returns
+  // nullptr otherwise.
+  std::unique_ptr<Job> TakeFinishedJob(Tagged<IrRegExpData> re_data);
+
+  // Waits for all jobs to finish, running those that haven't started yet on
+  // the main thread.
+  void FinishAllJobsForTesting();
+
+ private:
+  class CompileTask;
+
+  static constexpr size_t kMaxJobs = 8;
+
+  Job* FindJob(Tagged<IrRegExpData> re_data) const;
+
+  Isolate* const isolate_;
+  // Only accessed on the main thread. Worker threads only see the jobs.
+  std::vector<std::unique_ptr<Job>> jobs_;
+};
+
+class RegExpConcurrentCompiler::Job final {
+ public:
+  // Creates a job compiling `re_data` for native code. The compiler can be
+  // configured before the job is started.
+  Job(Isolate* isolate, DirectHandle<IrRegExpData> re_data, bool is_one_byte);
+  ~Job();
+  Job(const Job&) = delete;
+  Job& operator=(const Job&) = delete;
+
+  // Runs the front end on the current thread.
+  void Run(uintptr_t stack_limit);
+  // Runs the front end on the main thread if the task hasn't started yet, and
+  // waits for it to finish otherwise.
+  void RunOrWait();
+  bool IsFinished() const { return finished_.load(std::memory_order_acquire); }
+
+  bool IsFor(Tagged<IrRegExpData> re_data) const {
+    return *re_data_.location() == re_data.ptr();
+  }
+  IndirectHandle<IrRegExpData> re_data() const { return re_data_; }
+  bool is_one_byte() const { return is_one_byte_; }
+  RegExpCompiler* compiler() { return &compiler_.value(); }
+  // The result of the front end. The error is set if it failed.
+  RegExpCompileData* compile_data() { return &compile_data_; }
+
+  void set_task_id(CancelableTaskManager::Id task_id) { task_id_ = task_id; }
+
+ private:
+  void RunFrontEnd(uintptr_t stack_limit);
+
+  Isolate* const isolate_;
+  IndirectHandle<IrRegExpData> re_data_;
+  const RegExpFlags flags_;
+  const bool is_one_byte_;
+  base::OwnedVector<base::uc16> pattern_;
+  Zone zone_;
+  std::optional<RegExpCompiler> compiler_;
+  RegExpCompileData compile_data_;
+  CancelableTaskManager::Id task_id_ = CancelableTaskManager::kInvalidTaskId;
+  std::atomic<bool> finished_{false};
+  // Shared with a running worker, which signals it after `finished_` is set.
+  const std::shared_ptr<base::Semaphore> finished_signal_ =
+      std::make_shared<base::Semaphore>(0);
+};
+
+}  // namespace v8::internal
+
+#endif  // V8_REGEXP_REGEXP_CONCURRENT_COMPILER_H_
@@ -13,6 +13,7 @@
 #include "src/objects/js-regexp-inl.h"
 #include "src/objects/string-inl.h"
 #include "src/regexp/regexp-bytecodes.h"
+#include "src/regexp/regexp-concurrent-compiler.h"
 #include "src/regexp/regexp-macro-assembler.h"
 #include "src/regexp/regexp-stack.h"  // For kMaximumStackSize.
 #include "src/regexp/regexp-utils.h"
@@ -1199,6 +1200,11 @@ int IrregexpInterpreter::MatchForCallFromJs(
     // for tier-up takes place.
     return IrregexpInterpreter::RETRY;
   }
+  if (regexp_data_obj->TierUpInProgress() &&
+      isolate->regexp_concurrent_compiler()->IsJobFinished(regexp_data_obj)) {
+    // The front end has run on a worker thread; generate the code in runtime.
+    return IrregexpInterpreter::RETRY;
+  }
 
   return Match(isolate, regexp_data_obj, subject_string, output_registers,
                output_register_count, start_position, call_origin);
@@ -436,6 +436,16 @@ bool RegExpMacroAssemblerTracer::CheckSpecialClassRanges(
   return supported;
 }
 
+bool RegExpMacroAssemblerTracer::CheckRequiredLiterals(
+    const ZoneList<base::Vector<const base::uc16>>* literals,
+    Label* on_found) {
+  bool supported = assembler_->CheckRequiredLiterals(literals, on_found);
+  PrintF(" CheckRequiredLiterals(count=%d, label[%08x]): %s;\n",
+         literals->length(), LabelToInt(on_found),
+         supported ? "true" : "false");
+  return supported;
+}
+
 void RegExpMacroAssemblerTracer::IfRegisterLT(int register_index,
                                               int comparand, Label* if_lt) {
   PrintF(" IfRegisterLT(register=%d, number=%d, label[%08x]);\n",
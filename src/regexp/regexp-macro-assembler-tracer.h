@@ -64,6 +64,9 @@ class RegExpMacroAssemblerTracer: public RegExpMacroAssembler {
   void CheckPosition(int cp_offset, Label* on_outside_input) override;
   bool CheckSpecialClassRanges(StandardCharacterSet type,
                                Label* on_no_match) override;
+  bool CheckRequiredLiterals(
+      const ZoneList<base::Vector<const base::uc16>>* literals,
+      Label* on_found) override;
   void Fail() override;
   DirectHandle<HeapObject> GetCode(DirectHandle<String> source,
                                    RegExpFlags flags) override;
@@ -9,6 +9,7 @@
 #include "src/execution/isolate-inl.h"
 #include "src/execution/pointer-authentication.h"
 #include "src/execution/simulator.h"
+#include "src/regexp/regexp-required-literals.h"
 #include "src/regexp/regexp-stack.h"
 #include "src/regexp/special-case.h"
 #include "src/strings/unicode-inl.h"
@@ -179,6 +180,17 @@ Handle<ByteArray> NativeRegExpMacroAssembler::GetOrAddRangeArray(
   return range_array;
 }
 
+Handle<ByteArray> NativeRegExpMacroAssembler::MakeRequiredLiteralArray(
+    const ZoneList<base::Vector<const base::uc16>>* literals) {
+  const int length = RegExpRequiredLiterals::EncodedLength(literals);
+  Handle<FixedUInt16Array> literal_array =
+      FixedUInt16Array::New(isolate(), length);
+  base::Vector<base::uc16> encoded = zone()->NewVector<base::uc16>(length);
+  RegExpRequiredLiterals::Encode(literals, encoded);
+  for (int i = 0; i < length; i++) literal_array->set(i, encoded[i]);
+  return literal_array;
+}
+
 // static
 uint32_t RegExpMacroAssembler::IsCharacterInRangeArray(uint32_t current_char,
                                                        Address raw_byte_array) {
@@ -224,6 +236,28 @@ uint32_t RegExpMacroAssembler::IsCharacterInRangeArray(uint32_t current_char,
   return (current_range_start_index % 2) == 0 ? kTrue : kFalse;
 }
 
+// static
+uint32_t RegExpMacroAssembler::ContainsRequiredLiteral(
+    Address raw_literal_array, Address position, Address end,
+    uint32_t is_one_byte) {
+  Tagged<FixedUInt16Array> literal_array =
+      Cast<FixedUInt16Array>(Tagged<Object>(raw_literal_array));
+  base::Vector<const base::uc16> encoded(
+      reinterpret_cast<const base::uc16*>(literal_array->begin()),
+      literal_array->length());
+  bool found;
+  if (is_one_byte) {
+    found = RegExpRequiredLiterals::ContainsAny(
+        encoded, reinterpret_cast<const uint8_t*>(position),
+        reinterpret_cast<const uint8_t*>(end));
+  } else {
+    found = RegExpRequiredLiterals::ContainsAny(
+        encoded, reinterpret_cast<const base::uc16*>(position),
+        reinterpret_cast<const base::uc16*>(end));
+  }
+  return found ? 1 : 0;
+}
+
 void RegExpMacroAssembler::CheckNotInSurrogatePair(int cp_offset,
                                                    Label* on_failure) {
   Label ok;
@@ -125,6 +125,18 @@ class RegExpMacroAssembler {
                                        Label* on_no_match) {
     return false;
   }
+  // Searches the input from the current position to the end for any of the
+  // given literals (see RegExpRequiredLiterals), and jumps to on_found if one
+  // occurs. Also jumps to on_found without searching if the rest of the input
+  // is shorter than RegExpRequiredLiterals::MinSubjectLength, and on restarts
+  // of global regexps: the previous match contained a literal, so the search
+  // only runs on entry. Returns false if the search is not supported, in which
+  // case no code was emitted.
+  virtual bool CheckRequiredLiterals(
+      const ZoneList<base::Vector<const base::uc16>>* literals,
+      Label* on_found) {
+    return false;
+  }
 
   // Control-flow integrity:
   // Define a jump target and bind a label.
@@ -224,6 +236,15 @@ class RegExpMacroAssembler {
   static uint32_t IsCharacterInRangeArray(uint32_t current_char,
                                           Address raw_byte_array);
 
+  // `raw_literal_array` is a FixedUInt16Array containing required literals
+  // as encoded by RegExpRequiredLiterals::Encode. Returns non-zero if one of
+  // them occurs in the input between `position` and `end`, zero otherwise.
+  //
+  // Called from generated code.
+  static uint32_t ContainsRequiredLiteral(Address raw_literal_array,
+                                          Address position, Address end,
+                                          uint32_t is_one_byte);
+
   // Controls the generation of large inlined constants in the code.
   void set_slow_safe(bool ssc) { slow_safe_compiler_ = ssc; }
   bool slow_safe() const { return slow_safe_compiler_; }
@@ -351,6 +372,8 @@ class NativeRegExpMacroAssembler: public RegExpMacroAssembler {
   static const uint8_t word_character_map[256];
 
   Handle<ByteArray> GetOrAddRangeArray(const ZoneList<CharacterRange>* ranges);
+  Handle<ByteArray> MakeRequiredLiteralArray(
+      const ZoneList<base::Vector<const base::uc16>>* literals);
 
  private:
   // Returns a {Result} sentinel, or the number of successful matches.
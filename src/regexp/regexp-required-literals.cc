@@ -0,0 +1,371 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-required-literals.h"
+
+#include <algorithm>
+
+#include "hwy/highway.h"
+#include "src/base/bits.h"
+#include "src/regexp/regexp-ast.h"
+#include "src/strings/unicode.h"
+#include "src/zone/zone-list-inl.h"
+
+namespace v8::internal {
+
+namespace {
+
+using Literal = RegExpRequiredLiterals::Literal;
+using LiteralList = ZoneList<Literal>;
+
+int MinLength(const LiteralList* literals) {
+  int min_length = RegExpRequiredLiterals::kMaxLiteralLength;
+  for (const Literal& literal : *literals) {
+    min_length = std::min(min_length, literal.length());
+  }
+  return min_length;
+}
+
+// Returns whether `a` is a better set of literals to search for than `b`:
+// Long literals are rare and make for few false positives, and fewer literals
+// are faster to search for.
+bool IsBetter(const LiteralList* a, const LiteralList* b) {
+  if (a == nullptr) return false;
+  if (b == nullptr) return true;
+  static constexpr int kLongEnough = 4;
+  int a_length = std::min(MinLength(a), kLongEnough);
+  int b_length = std::min(MinLength(b), kLongEnough);
+  if (a_length != b_length) return a_length > b_length;
+  if (a->length() != b->length()) return a->length() < b->length();
+  return MinLength(a) > MinLength(b);
+}
+
+// Computes the required literals of a subtree.  Returns nullptr if it can
+// match without consuming a fixed string.
+class RequiredLiteralsVisitor final : private RegExpVisitor {
+ public:
+  RequiredLiteralsVisitor(RegExpFlags flags, Zone* zone)
+      : flags_(flags), zone_(zone) {}
+
+  LiteralList* Visit(RegExpTree* tree) {
+    return static_cast<LiteralList*>(tree->Accept(this, nullptr));
+  }
+
+ private:
+  LiteralList* Single(Literal literal) {
+    if (literal.empty()) return nullptr;
+    // In unicode mode, a match may start one character before the start
+    // position to include a lead surrogate.
+    if (IsEitherUnicode(flags_) &&
+        unibrow::Utf16::IsLeadSurrogate(literal[0])) {
+      return nullptr;
+    }
+    int length =
+        std::min(literal.length(), RegExpRequiredLiterals::kMaxLiteralLength);
+    LiteralList* result = zone_->New<LiteralList>(1, zone_);
+    result->Add(literal.SubVector(0, length), zone_);
+    return result;
+  }
+
+  void* VisitDisjunction(RegExpDisjunction* node, void*) override {
+    // Every alternative needs to contribute a literal.
+    LiteralList* result = zone_->New<LiteralList>(2, zone_);
+    for (RegExpTree* alternative : *node->alternatives()) {
+      LiteralList* literals = Visit(alternative);
+      if (literals == nullptr) return nullptr;
+      for (const Literal& literal : *literals) {
+        bool is_duplicate = std::any_of(
+            result->begin(), result->end(),
+            [&](const Literal& other) { return other == literal; });
+        if (!is_duplicate) result->Add(literal, zone_);
+      }
+      if (result->length() > RegExpRequiredLiterals::kMaxLiterals) {
+        return nullptr;
+      }
+    }
+    return result;
+  }
+
+  void* VisitAlternative(RegExpAlternative* node, void*) override {
+    // Any of the terms' literals will do.
+    LiteralList* best = nullptr;
+    for (RegExpTree* term : *node->nodes()) {
+      LiteralList* literals = Visit(term);
+      if (IsBetter(literals, best)) best = literals;
+    }
+    return best;
+  }
+
+  void* VisitText(RegExpText* node, void*) override {
+    Literal longest;
+    for (const TextElement& element : *node->elements()) {
+      if (element.text_type() != TextElement::ATOM) continue;
+      Literal data = element.atom()->data();
+      if (data.length() > longest.length()) longest = data;
+    }
+    return Single(longest);
+  }
+
+  void* VisitAtom(RegExpAtom* node, void*) override {
+    return Single(node->data());
+  }
+
+  void* VisitQuantifier(RegExpQuantifier* node, void*) override {
+    if (node->min() == 0) return nullptr;
+    return Visit(node->body());
+  }
+
+  void* VisitCapture(RegExpCapture* node, void*) override {
+    return Visit(node->body());
+  }
+
+  void* VisitGroup(RegExpGroup* node, void*) override {
+    // Modifiers may make the body case-insensitive.
+    if (node->flags() != flags_) return nullptr;
+    return Visit(node->body());
+  }
+
+  // Lookarounds may look before the start position, and the other terms
+  // don't consume fixed strings.
+  void* VisitLookaround(RegExpLookaround* node, void*) override {
+    return nullptr;
+  }
+  void* VisitAssertion(RegExpAssertion* node, void*) override {
+    return nullptr;
+  }
+  void* VisitClassRanges(RegExpClassRanges* node, void*) override {
+    return nullptr;
+  }
+  void* VisitClassSetOperand(RegExpClassSetOperand* node, void*) override {
+    return nullptr;
+  }
+  void* VisitClassSetExpression(RegExpClassSetExpression* node,
+                                void*) override {
+    return nullptr;
+  }
+  void* VisitBackReference(RegExpBackReference* node, void*) override {
+    return nullptr;
+  }
+  void* VisitEmpty(RegExpEmpty* node, void*) override { return nullptr; }
+
+  const RegExpFlags flags_;
+  Zone* const zone_;
+};
+
+// A decoded view of the encoded literals.
+struct LiteralSet {
+  static constexpr int kMaxLiterals = RegExpRequiredLiterals::kMaxLiterals;
+
+  template <typename Char>
+  LiteralSet(base::Vector<const base::uc16> encoded, const Char*) {
+    int count = encoded[0];
+    DCHECK_LE(count, kMaxLiterals);
+    int pos = 1;
+    for (int i = 0; i < count; ++i) {
+      int length = encoded[pos++];
+      Literal literal = encoded.SubVector(pos, pos + length);
+      pos += length;
+      // Literals with two-byte characters can't occur in one-byte subjects.
+      if (sizeof(Char) == 1 &&
+          std::any_of(literal.begin(), literal.end(), [](base::uc16 c) {
+            return c > unibrow::Latin1::kMaxChar;
+          })) {
+        continue;
+      }
+      literals[size++] = literal;
+      min_length = std::min(min_length, length);
+    }
+  }
+
+  template <typename Char>
+  bool MatchesAt(const Char* position, const Char* end) const {
+    for (int i = 0; i < size; ++i) {
+      if (MatchesAt(i, position, end)) return true;
+    }
+    return false;
+  }
+
+  template <typename Char>
+  bool MatchesAt(int i, const Char* position, const Char* end) const {
+    const Literal& literal = literals[i];
+    if (end - position < literal.length()) return false;
+    for (int j = 0; j < literal.length(); ++j) {
+      if (position[j] != literal[j]) return false;
+    }
+    return true;
+  }
+
+  Literal literals[kMaxLiterals];
+  int size = 0;
+  int min_length = RegExpRequiredLiterals::kMaxLiteralLength;
+};
+
+namespace hw = hwy::HWY_NAMESPACE;
+
+// Teddy-style search: Each literal gets a bit in a bucket mask, and for each
+// of the first few characters of the literals, two 16-byte tables map the low
+// and high nibble of a subject byte to the buckets of literals that can have
+// it at this offset.  The tables are applied with byte shuffles to a vector
+// of subject bytes at a time, and only positions that pass all of them are
+// checked for a full match.
+bool ContainsAnyOneByte(const LiteralSet& set, const uint8_t* begin,
+                        const uint8_t* end) {
+  static_assert(LiteralSet::kMaxLiterals <= 8);
+  static constexpr int kMaxFingerprintLength = 3;
+  const int fingerprint_length =
+      std::min(set.min_length, kMaxFingerprintLength);
+
+  HWY_ALIGN uint8_t low_nibbles[kMaxFingerprintLength][16] = {};
+  HWY_ALIGN uint8_t high_nibbles[kMaxFingerprintLength][16] = {};
+  for (int i = 0; i < set.size; ++i) {
+    for (int j = 0; j < fingerprint_length; ++j) {
+      base::uc16 c = set.literals[i][j];
+      low_nibbles[j][c & 0xF] |= 1 << i;
+      high_nibbles[j][c >> 4] |= 1 << i;
+    }
+  }
+
+  const hw::ScalableTag<uint8_t> d;
+  const size_t lanes = hw::Lanes(d);
+  const auto nibble_mask = hw::Set(d, uint8_t{0xF});
+  const uint8_t* position = begin;
+  while (static_cast<size_t>(end - position) >=
+         lanes + fingerprint_length - 1) {
+    auto buckets = hw::Set(d, uint8_t{0xFF});
+    for (int j = 0; j < fingerprint_length; ++j) {
+      const auto input = hw::LoadU(d, position + j);
+      const auto low = hw::TableLookupBytes(hw::LoadDup128(d, low_nibbles[j]),
+                                            hw::And(input, nibble_mask));
+      const auto high = hw::TableLookupBytes(
+          hw::LoadDup128(d, high_nibbles[j]), hw::ShiftRight<4>(input));
+      buckets = hw::And(buckets, hw::And(low, high));
+    }
+    if (!hw::AllFalse(d, hw::Ne(buckets, hw::Zero(d)))) {
+      HWY_ALIGN uint8_t candidates[HWY_MAX_BYTES];
+      hw::Store(buckets, d, candidates);
+      for (size_t k = 0; k < lanes; ++k) {
+        for (uint8_t bits = candidates[k]; bits != 0; bits &= bits - 1) {
+          int i = base::bits::CountTrailingZeros(bits);
+          if (set.MatchesAt(i, position + k, end)) return true;
+        }
+      }
+    }
+    position += lanes;
+  }
+
+  for (; position < end; ++position) {
+    if (set.MatchesAt(position, end)) return true;
+  }
+  return false;
+}
+
+// For two-byte subjects, the first two characters of every literal are
+// compared against a vector of subject characters at a time.
+bool ContainsAnyTwoByte(const LiteralSet& set, const base::uc16* begin,
+                        const base::uc16* end) {
+  const hw::ScalableTag<uint16_t> d;
+  const size_t lanes = hw::Lanes(d);
+  base::uc16 first[LiteralSet::kMaxLiterals];
+  base::uc16 second[LiteralSet::kMaxLiterals];
+  bool single_char[LiteralSet::kMaxLiterals];
+  for (int i = 0; i < set.size; ++i) {
+    const Literal& literal = set.literals[i];
+    single_char[i] = literal.length() == 1;
+    first[i] = literal[0];
+    second[i] = literal[single_char[i] ? 0 : 1];
+  }
+
+  const base::uc16* position = begin;
+  while (static_cast<size_t>(end - position) >= lanes + 1) {
+    const auto input = hw::LoadU(d, position);
+    const auto next_input = hw::LoadU(d, position + 1);
+    auto candidates = hw::Zero(d);
+    for (int i = 0; i < set.size; ++i) {
+      const auto match =
+          hw::And(hw::Eq(input, hw::Set(d, first[i])),
+                  hw::Eq(single_char[i] ? input : next_input,
+                         hw::Set(d, second[i])));
+      candidates = hw::Or(candidates, hw::VecFromMask(d, match));
+    }
+    if (!hw::AllFalse(d, hw::Ne(candidates, hw::Zero(d)))) {
+      HWY_ALIGN uint16_t lane_candidates[HWY_MAX_BYTES / sizeof(uint16_t)];
+      hw::Store(candidates, d, lane_candidates);
+      for (size_t k = 0; k < lanes; ++k) {
+        if (lane_candidates[k] != 0 && set.MatchesAt(position + k, end)) {
+          return true;
+        }
+      }
+    }
+    position += lanes;
+  }
+
+  for (; position < end; ++position) {
+    if (set.MatchesAt(position, end)) return true;
+  }
+  return false;
+}
+
+}  // namespace
+
+// static
+ZoneList<Literal>* RegExpRequiredLiterals::Extract(RegExpTree* tree,
+                                                   RegExpFlags flags,
+                                                   Zone* zone) {
+  if (IsIgnoreCase(flags)) return nullptr;
+  return RequiredLiteralsVisitor(flags, zone).Visit(tree);
+}
+
+// static
+int RegExpRequiredLiterals::MinSubjectLength(
+    const ZoneList<Literal>* literals) {
+  int max_length = 0;
+  for (const Literal& literal : *literals) {
+    max_length = std::max(max_length, literal.length());
+  }
+  return kMinSubjectLengthPerLiteralChar * max_length;
+}
+
+// static
+int RegExpRequiredLiterals::EncodedLength(const ZoneList<Literal>* literals) {
+  int length = 1;
+  for (const Literal& literal : *literals) length += 1 + literal.length();
+  return length;
+}
+
+// static
+void RegExpRequiredLiterals::Encode(const ZoneList<Literal>* literals,
+                                    base::Vector<base::uc16> encoded) {
+  DCHECK_EQ(encoded.length(), EncodedLength(literals));
+  DCHECK_LE(literals->length(), kMaxLiterals);
+  int pos = 0;
+  encoded[pos++] = literals->length();
+  for (const Literal& literal : *literals) {
+    DCHECK_LE(literal.length(), kMaxLiteralLength);
+    encoded[pos++] = literal.length();
+    std::copy(literal.begin(), literal.end(), &encoded[pos]);
+    pos += literal.length();
+  }
+}
+
+// static
+template <typename Char>
+bool RegExpRequiredLiterals::ContainsAny(base::Vector<const base::uc16> encoded,
+                                         const Char* begin, const Char* end) {
+  LiteralSet set(encoded, begin);
+  if (set.size == 0) return false;
+  if constexpr (sizeof(Char) == 1) {
+    return ContainsAnyOneByte(set, begin, end);
+  } else {
+    return ContainsAnyTwoByte(set, begin, end);
+  }
+}
+
+template bool RegExpRequiredLiterals::ContainsAny(
+    base::Vector<const base::uc16> encoded, const uint8_t* begin,
+    const uint8_t* end);
+template bool RegExpRequiredLiterals::ContainsAny(
+    base::Vector<const base::uc16> encoded, const base::uc16* begin,
+    const base::uc16* end);
+
+}  // namespace v8::internal
@@ -0,0 +1,60 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_REQUIRED_LITERALS_H_
+#define V8_REGEXP_REGEXP_REQUIRED_LITERALS_H_
+
+#include "src/base/strings.h"
+#include "src/base/vector.h"
+#include "src/regexp/regexp-flags.h"
+#include "src/zone/zone-list.h"
+
+namespace v8::internal {
+
+class RegExpTree;
+class Zone;
+
+// Required literals are a small set of strings such that every match of a
+// regexp contains at least one of them, e.g. {"ERROR"} for /\d+ ERROR: .*/ or
+// {"GET", "POST"} for /(GET|POST) \/api/.  If none of them occurs in the
+// subject after the start position, the regexp can't match, which is checked
+// with a vectorized multi-literal search before running the backtracking
+// matcher.
+class RegExpRequiredLiterals final : public AllStatic {
+ public:
+  using Literal = base::Vector<const base::uc16>;
+
+  // The maximum number of literals and characters per literal that are
+  // searched for.  Longer literals are truncated to a prefix, which is
+  // required as well.
+  static constexpr int kMaxLiterals = 8;
+  static constexpr int kMaxLiteralLength = 64;
+
+  // The search is only worth a call out of the generated code if the rest of
+  // the subject is long compared to the literals.
+  static constexpr int kMinSubjectLengthPerLiteralChar = 16;
+
+  // Returns the required literals of the main expression of `tree`, ignoring
+  // lookarounds, or nullptr if there are none.
+  static ZoneList<Literal>* Extract(RegExpTree* tree, RegExpFlags flags,
+                                    Zone* zone);
+
+  // Returns the length below which the rest of the subject is not searched.
+  static int MinSubjectLength(const ZoneList<Literal>* literals);
+
+  // Encodes `literals` as [n, length_0, chars_0..., length_1, chars_1...] for
+  // `ContainsAny`.
+  static int EncodedLength(const ZoneList<Literal>* literals);
+  static void Encode(const ZoneList<Literal>* literals,
+                     base::Vector<base::uc16> encoded);
+
+  // Returns whether one of the `encoded` literals occurs in [begin, end).
+  template <typename Char>
+  static bool ContainsAny(base::Vector<const base::uc16> encoded,
+                          const Char* begin, const Char* end);
+};
+
+}  // namespace v8::internal
+
+#endif  // V8_REGEXP_REGEXP_REQUIRED_LITERALS_H_
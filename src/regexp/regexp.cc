@@ -9,19 +9,24 @@
 #include "src/diagnostics/code-tracer.h"
 #include "src/execution/interrupts-scope.h"
 #include "src/heap/heap-inl.h"
+#include "src/init/isolate-group.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/regexp/experimental/experimental.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "src/regexp/regexp-bytecode-generator.h"
 #include "src/regexp/regexp-bytecodes.h"
 #include "src/regexp/regexp-compiler.h"
+#include "src/regexp/regexp-concurrent-compiler.h"
 #include "src/regexp/regexp-dotprinter.h"
 #include "src/regexp/regexp-interpreter.h"
 #include "src/regexp/regexp-macro-assembler-arch.h"
 #include "src/regexp/regexp-macro-assembler-tracer.h"
 #include "src/regexp/regexp-parser.h"
+#include "src/regexp/regexp-required-literals.h"
 #include "src/regexp/regexp-stack.h"
 #include "src/regexp/regexp-utils.h"
 #include "src/strings/string-search.h"
+#include "src/utils/memcopy.h"
 #include "src/utils/ostreams.h"
 
 namespace v8 {
@@ -100,12 +105,37 @@ class RegExpImpl final : public AllStatic {
                                             DirectHandle<IrRegExpData> re_data,
                                             DirectHandle<String> sample_subject,
                                             bool is_one_byte);
+  // Stores the result of a successful compilation in `re_data`.
+  static void InstallIrregexp(Isolate* isolate,
+                              DirectHandle<IrRegExpData> re_data,
+                              RegExpCompileData* compile_data, bool is_one_byte,
+                              uint32_t backtrack_limit);
+
+  // Posts the front end of the tier-up compilation to a worker thread. Returns
+  // false if the regexp has to be compiled synchronously instead.
+  static bool StartConcurrentTierUp(Isolate* isolate,
+                                    DirectHandle<IrRegExpData> re_data,
+                                    DirectHandle<String> sample_subject,
+                                    bool is_one_byte);
+  // Generates native code from the result of a finished concurrent job.
+  static bool FinishConcurrentTierUp(Isolate* isolate,
+                                     DirectHandle<IrRegExpData> re_data,
+                                     RegExpConcurrentCompiler::Job* job);
 
   // Returns true on success, false on failure.
   static bool Compile(Isolate* isolate, Zone* zone, RegExpCompileData* input,
                       RegExpFlags flags, DirectHandle<String> pattern,
                       DirectHandle<String> sample_subject, bool is_one_byte,
                       uint32_t& backtrack_limit);
+  // Configures `compiler` based on the pattern and a sample of the subject.
+  static void PrepareCompiler(Isolate* isolate, RegExpCompiler* compiler,
+                              DirectHandle<String> pattern,
+                              DirectHandle<String> sample_subject);
+  // Generates code or bytecode from the analyzed node graph in `data`.
+  static bool Assemble(Isolate* isolate, RegExpCompiler* compiler,
+                       RegExpCompileData* data, RegExpFlags flags,
+                       DirectHandle<String> pattern, bool is_one_byte,
+                       uint32_t& backtrack_limit);
 };
 
 // static
@@ -539,6 +569,39 @@ bool RegExpImpl::EnsureCompiledIrregexp(Isolate* isolate,
   // strategy is not in use, this value is always false.
   bool needs_tier_up_compilation = re_data->MarkedForTierUp() && has_bytecode;
 
+  if (v8_flags.regexp_concurrent_tier_up && has_bytecode &&
+      (needs_tier_up_compilation || re_data->TierUpInProgress())) {
+    RegExpConcurrentCompiler* concurrent_compiler =
+        isolate->regexp_concurrent_compiler();
+    std::unique_ptr<RegExpConcurrentCompiler::Job> job =
+        concurrent_compiler->TakeFinishedJob(*re_data);
+    if (job) {
+      re_data->MarkTierUpForNextExec();
+      if (job->is_one_byte() == is_one_byte &&
+          job->compile_data()->error == RegExpError::kNone) {
+        return FinishConcurrentTierUp(isolate, re_data, job.get());
+      }
+      // The subject changed its representation in the meantime, or the front
+      // end failed; recompile synchronously, which also reports the error.
+      return CompileIrregexp(isolate, re_data, sample_subject, is_one_byte);
+    }
+    if (concurrent_compiler->HasJob(*re_data)) {
+      // Keep interpreting until the job has finished. The tier-up may have
+      // been forced again in the meantime, e.g. for global execution.
+      if (!re_data->TierUpInProgress()) re_data->MarkTierUpInProgress();
+      return true;
+    }
+    if (needs_tier_up_compilation &&
+        StartConcurrentTierUp(isolate, re_data, sample_subject, is_one_byte)) {
+      return true;
+    }
+    if (re_data->TierUpInProgress()) {
+      // The job has been dropped; tier up synchronously instead.
+      re_data->MarkTierUpForNextExec();
+      needs_tier_up_compilation = true;
+    }
+  }
+
   if (v8_flags.trace_regexp_tier_up && needs_tier_up_compilation) {
     PrintF("JSRegExp object (data: %p) needs tier-up compilation\n",
            reinterpret_cast<void*>(re_data->ptr()));
@@ -555,6 +618,79 @@ bool RegExpImpl::EnsureCompiledIrregexp(Isolate* isolate,
   return CompileIrregexp(isolate, re_data, sample_subject, is_one_byte);
 }
 
+// static
+bool RegExpImpl::StartConcurrentTierUp(Isolate* isolate,
+                                       DirectHandle<IrRegExpData> re_data,
+                                       DirectHandle<String> sample_subject,
+                                       bool is_one_byte) {
+  // Long subjects force the tier-up since the interpreter is too slow for them,
+  // so waiting for a worker thread would defeat the purpose.
+  if (sample_subject->length() >= JSRegExp::kTierUpForSubjectLengthValue) {
+    return false;
+  }
+  RegExpFlags flags = JSRegExp::AsRegExpFlags(re_data->flags());
+  DirectHandle<String> pattern(re_data->source(), isolate);
+  pattern = String::Flatten(isolate, pattern);
+  if (!RegExpConcurrentCompiler::CanCompileConcurrently(*pattern, flags)) {
+    return false;
+  }
+  if (JSRegExp::RegistersForCaptureCount(re_data->capture_count()) >
+      RegExpMacroAssembler::kMaxRegisterCount) {
+    return false;
+  }
+
+  auto job = std::make_unique<RegExpConcurrentCompiler::Job>(isolate, re_data,
+                                                             is_one_byte);
+  PrepareCompiler(isolate, job->compiler(), pattern, sample_subject);
+  if (!isolate->regexp_concurrent_compiler()->StartJob(std::move(job))) {
+    return false;
+  }
+  re_data->MarkTierUpInProgress();
+  if (v8_flags.trace_regexp_tier_up) {
+    PrintF("JSRegExp object (data: %p) started concurrent tier-up\n",
+           reinterpret_cast<void*>(re_data->ptr()));
+  }
+  return true;
+}
+
+// static
+bool RegExpImpl::FinishConcurrentTierUp(Isolate* isolate,
+                                        DirectHandle<IrRegExpData> re_data,
+                                        RegExpConcurrentCompiler::Job* job) {
+  DCHECK(job->IsFinished());
+  DCHECK_EQ(job->compile_data()->error, RegExpError::kNone);
+  DCHECK(!re_data->ShouldProduceBytecode());
+
+  // Like CompileIrregexp, but the node graph has been built and analyzed on a
+  // worker thread already.
+  StackLimitCheck check(isolate);
+  if (check.JsHasOverflowed(kStackSpaceRequiredForCompilation * KB)) {
+    if (v8_flags.correctness_fuzzer_suppressions) {
+      FATAL("Aborting on stack overflow");
+    }
+    RegExp::ThrowRegExpException(isolate, re_data,
+                                 RegExpError::kAnalysisStackOverflow);
+    return false;
+  }
+  PostponeInterruptsScope postpone(isolate);
+
+  RegExpFlags flags = JSRegExp::AsRegExpFlags(re_data->flags());
+  DirectHandle<String> pattern(re_data->source(), isolate);
+  pattern = String::Flatten(isolate, pattern);
+  RegExpCompileData* compile_data = job->compile_data();
+  job->compiler()->set_stack_limit(isolate->stack_guard()->real_climit());
+  uint32_t backtrack_limit = re_data->backtrack_limit();
+  if (!Assemble(isolate, job->compiler(), compile_data, flags, pattern,
+                job->is_one_byte(), backtrack_limit)) {
+    DCHECK(compile_data->error != RegExpError::kNone);
+    RegExp::ThrowRegExpException(isolate, re_data, compile_data->error);
+    return false;
+  }
+  InstallIrregexp(isolate, re_data, compile_data, job->is_one_byte(),
+                  backtrack_limit);
+  return true;
+}
+
 namespace {
 
 #ifdef DEBUG
@@ -645,6 +781,33 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate,
 
   DirectHandle<String> pattern(re_data->source(), isolate);
   pattern = String::Flatten(isolate, pattern);
+
+  // Bytecode compiled by another isolate of the group can be reused as is.
+  RegExpBytecodeCache* bytecode_cache =
+      isolate->isolate_group()->regexp_bytecode_cache();
+  const bool use_bytecode_cache = v8_flags.regexp_shared_bytecode_cache &&
+                                  re_data->ShouldProduceBytecode();
+  const uint32_t initial_backtrack_limit = re_data->backtrack_limit();
+  if (use_bytecode_cache) {
+    std::shared_ptr<const RegExpBytecodeCache::Entry> entry =
+        bytecode_cache->Lookup(*pattern, flags, is_one_byte,
+                               initial_backtrack_limit);
+    if (entry) {
+      DirectHandle<TrustedByteArray> bytecode =
+          isolate->factory()->NewTrustedByteArray(
+              static_cast<int>(entry->bytecode.size()));
+      MemCopy(bytecode->begin(), entry->bytecode.begin(),
+              entry->bytecode.size());
+      RegExpCompileData compile_data;
+      compile_data.compilation_target = RegExpCompilationTarget::kBytecode;
+      compile_data.code = bytecode;
+      compile_data.register_count = entry->register_count;
+      InstallIrregexp(isolate, re_data, &compile_data, is_one_byte,
+                      entry->backtrack_limit);
+      return true;
+    }
+  }
+
   RegExpCompileData compile_data;
   if (!RegExpParser::ParseRegExpFromHeapString(isolate, &zone, pattern, flags,
                                                &compile_data)) {
@@ -672,29 +835,53 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate,
     return false;
   }
 
-  if (compile_data.compilation_target == RegExpCompilationTarget::kNative) {
-    re_data->set_code(is_one_byte, Cast<Code>(*compile_data.code));
+  InstallIrregexp(isolate, re_data, &compile_data, is_one_byte,
+                  backtrack_limit);
+
+  // Named captures are only cached as part of the capture name map, which is
+  // a heap object.
+  if (use_bytecode_cache &&
+      compile_data.compilation_target == RegExpCompilationTarget::kBytecode &&
+      compile_data.named_captures == nullptr) {
+    Tagged<TrustedByteArray> bytecode =
+        Cast<TrustedByteArray>(*compile_data.code);
+    bytecode_cache->Insert(
+        *pattern, flags, is_one_byte, initial_backtrack_limit,
+        std::make_shared<RegExpBytecodeCache::Entry>(
+            base::VectorOf(bytecode->begin(), bytecode->length()),
+            compile_data.register_count, backtrack_limit));
+  }
+  return true;
+}
+
+// static
+void RegExpImpl::InstallIrregexp(Isolate* isolate,
+                                 DirectHandle<IrRegExpData> re_data,
+                                 RegExpCompileData* compile_data,
+                                 bool is_one_byte, uint32_t backtrack_limit) {
+  if (compile_data->compilation_target == RegExpCompilationTarget::kNative) {
+    re_data->set_code(is_one_byte, Cast<Code>(*compile_data->code));
 
     // Reset bytecode to uninitialized. In case we use tier-up we know that
     // tier-up has happened this way.
     re_data->clear_bytecode(is_one_byte);
   } else {
-    DCHECK_EQ(compile_data.compilation_target,
+    DCHECK_EQ(compile_data->compilation_target,
               RegExpCompilationTarget::kBytecode);
     // Store code generated by compiler in bytecode and trampoline to
     // interpreter in code.
     re_data->set_bytecode(is_one_byte,
-                          Cast<TrustedByteArray>(*compile_data.code));
+                          Cast<TrustedByteArray>(*compile_data->code));
     DirectHandle<Code> trampoline =
         BUILTIN_CODE(isolate, RegExpInterpreterTrampoline);
     re_data->set_code(is_one_byte, *trampoline);
   }
   DirectHandle<FixedArray> capture_name_map =
-      RegExp::CreateCaptureNameMap(isolate, compile_data.named_captures);
+      RegExp::CreateCaptureNameMap(isolate, compile_data->named_captures);
   re_data->set_capture_name_map(capture_name_map);
   int register_max = re_data->max_register_count();
-  if (compile_data.register_count > register_max) {
-    re_data->set_max_register_count(compile_data.register_count);
+  if (compile_data->register_count > register_max) {
+    re_data->set_max_register_count(compile_data->register_count);
   }
   re_data->set_backtrack_limit(backtrack_limit);
 
@@ -706,8 +893,6 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate,
                ? re_data->bytecode(is_one_byte)->AllocatedSize()
                : re_data->code(isolate, is_one_byte)->Size());
   }
-
-  return true;
 }
 
 void RegExpImpl::IrregexpInitialize(Isolate* isolate, DirectHandle<JSRegExp> re,
@@ -971,9 +1156,28 @@ bool RegExpImpl::Compile(Isolate* isolate, Zone* zone, RegExpCompileData* data,
 
   RegExpCompiler compiler(isolate, zone, data->capture_count, flags,
                           is_one_byte);
+  PrepareCompiler(isolate, &compiler, pattern, sample_subject);
 
-  if (compiler.optimize()) {
-    compiler.set_optimize(!TooMuchRegExpCode(isolate, pattern));
+  data->node = compiler.PreprocessRegExp(data, is_one_byte);
+  if (data->error != RegExpError::kNone) {
+    return false;
+  }
+  data->error = AnalyzeRegExp(isolate, is_one_byte, flags, data->node,
+                              isolate->stack_guard()->real_climit());
+  if (data->error != RegExpError::kNone) {
+    return false;
+  }
+
+  return Assemble(isolate, &compiler, data, flags, pattern, is_one_byte,
+                  backtrack_limit);
+}
+
+// static
+void RegExpImpl::PrepareCompiler(Isolate* isolate, RegExpCompiler* compiler,
+                                 DirectHandle<String> pattern,
+                                 DirectHandle<String> sample_subject) {
+  if (compiler->optimize()) {
+    compiler->set_optimize(!TooMuchRegExpCode(isolate, pattern));
   }
 
   // Sample some characters from the middle of the string.
@@ -989,17 +1193,16 @@ bool RegExpImpl::Compile(Isolate* isolate, Zone* zone, RegExpCompileData* data,
     end = sample_subject->length();
   }
   for (uint32_t i = start; i < end; i++) {
-    compiler.frequency_collator()->CountCharacter(sample_subject->Get(i));
+    compiler->frequency_collator()->CountCharacter(sample_subject->Get(i));
   }
+}
 
-  data->node = compiler.PreprocessRegExp(data, is_one_byte);
-  if (data->error != RegExpError::kNone) {
-    return false;
-  }
-  data->error = AnalyzeRegExp(isolate, is_one_byte, flags, data->node);
-  if (data->error != RegExpError::kNone) {
-    return false;
-  }
+// static
+bool RegExpImpl::Assemble(Isolate* isolate, RegExpCompiler* compiler,
+                          RegExpCompileData* data, RegExpFlags flags,
+                          DirectHandle<String> pattern, bool is_one_byte,
+                          uint32_t& backtrack_limit) {
+  Zone* zone = compiler->zone();
 
   if (v8_flags.trace_regexp_graph) DotPrinter::DotPrint("Start", data->node);
 
@@ -1092,6 +1295,22 @@ bool RegExpImpl::Compile(Isolate* isolate, Zone* zone, RegExpCompileData* data,
     macro_assembler->set_global_mode(mode);
   }
 
+  // Fail early if the subject lacks a literal that every match contains. The
+  // search is skipped for short subjects and on global restarts (see
+  // CheckRequiredLiterals).
+  if (v8_flags.regexp_required_literals &&
+      data->compilation_target == RegExpCompilationTarget::kNative &&
+      !is_start_anchored && !IsSticky(flags)) {
+    ZoneList<base::Vector<const base::uc16>>* literals =
+        RegExpRequiredLiterals::Extract(data->tree, flags, zone);
+    Label literal_found;
+    if (literals != nullptr &&
+        macro_assembler->CheckRequiredLiterals(literals, &literal_found)) {
+      macro_assembler->Fail();
+      macro_assembler->Bind(&literal_found);
+    }
+  }
+
   RegExpMacroAssembler* macro_assembler_ptr = macro_assembler.get();
 #ifdef DEBUG
   std::unique_ptr<RegExpMacroAssembler> tracer_macro_assembler;
@@ -1102,7 +1321,7 @@ bool RegExpImpl::Compile(Isolate* isolate, Zone* zone, RegExpCompileData* data,
   }
 #endif
 
-  RegExpCompiler::CompilationResult result = compiler.Assemble(
+  RegExpCompiler::CompilationResult result = compiler->Assemble(
       isolate, macro_assembler_ptr, data->node, data->capture_count, pattern);
 
   // Code / bytecode printing.
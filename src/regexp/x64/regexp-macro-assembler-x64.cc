@@ -12,6 +12,7 @@
 #include "src/logging/log.h"
 #include "src/objects/code-inl.h"
 #include "src/regexp/regexp-macro-assembler.h"
+#include "src/regexp/regexp-required-literals.h"
 #include "src/regexp/regexp-stack.h"
 
 namespace v8 {
@@ -851,6 +852,44 @@ bool RegExpMacroAssemblerX64::CheckSpecialClassRanges(StandardCharacterSet type,
   }
 }
 
+bool RegExpMacroAssemblerX64::CheckRequiredLiterals(
+    const ZoneList<base::Vector<const base::uc16>>* literals,
+    Label* on_found) {
+  CheckPosition(RegExpRequiredLiterals::MinSubjectLength(literals) - 1,
+                on_found);
+  if (global()) {
+    __ cmpq(Operand(rbp, kSuccessfulCapturesOffset), Immediate(0));
+    BranchOrBacktrack(not_equal, on_found);
+  }
+
+  PushCallerSavedRegisters();
+
+  static const int kNumArguments = 4;
+  __ PrepareCallCFunction(kNumArguments);
+
+  // Compute the position and end before the argument registers (which may
+  // alias rsi and rdi) are overwritten.
+  __ leaq(rax, Operand(rsi, rdi, times_1, 0));
+  __ movq(r11, rsi);
+  __ Move(kCArgRegs[1], rax);
+  __ Move(kCArgRegs[2], r11);
+  __ Move(kCArgRegs[0], MakeRequiredLiteralArray(literals));
+  __ movl(kCArgRegs[3], Immediate(mode_ == LATIN1 ? 1 : 0));
+
+  {
+    // We have a frame (set up in GetCode), but the assembler doesn't know.
+    FrameScope scope(&masm_, StackFrame::MANUAL);
+    CallCFunctionFromIrregexpCode(
+        ExternalReference::re_contains_required_literal(), kNumArguments);
+  }
+
+  PopCallerSavedRegisters();
+  __ Move(code_object_pointer(), masm_.CodeObject());
+  __ testq(rax, rax);
+  BranchOrBacktrack(not_zero, on_found);
+  return true;
+}
+
 void RegExpMacroAssemblerX64::BindJumpTarget(Label* label) {
   Bind(label);
   // TODO(sroettger): There should be an endbr64 instruction here, but it needs
@@ -63,6 +63,9 @@ class V8_EXPORT_PRIVATE RegExpMacroAssemblerX64
   void CheckPosition(int cp_offset, Label* on_outside_input) override;
   bool CheckSpecialClassRanges(StandardCharacterSet type,
                                Label* on_no_match) override;
+  bool CheckRequiredLiterals(
+      const ZoneList<base::Vector<const base::uc16>>* literals,
+      Label* on_found) override;
 
   void BindJumpTarget(Label* label) override;
 
@@ -556,26 +556,45 @@ RUNTIME_FUNCTION(Runtime_WasmGetNumberOfInstances) {
   return Smi::FromInt(instance_count);
 }
 
-RUNTIME_FUNCTION(Runtime_WasmNumCodeSpaces) {
-  HandleScope scope(isolate);
-  if (args.length() != 1 || !IsJSObject(args[0])) {
-    return CrashUnlessFuzzing(isolate);
+namespace {
+
+// Returns the native module of a WasmInstanceObject or WasmModuleObject, or
+// nullptr for any other object.
+wasm::NativeModule* NativeModuleFromInstanceOrModule(Isolate* isolate,
+                                                     Tagged<Object> object) {
+  if (IsWasmInstanceObject(object)) {
+    return Cast<WasmInstanceObject>(object)
+        ->trusted_data(isolate)
+        ->native_module();
   }
-  DirectHandle<JSObject> argument = args.at<JSObject>(0);
-  wasm::NativeModule* native_module;
-  if (IsWasmInstanceObject(*argument)) {
-    native_module = Cast<WasmInstanceObject>(*argument)
-                        ->trusted_data(isolate)
-                        ->native_module();
-  } else if (IsWasmModuleObject(*argument)) {
-    native_module = Cast<WasmModuleObject>(*argument)->native_module();
-  } else {
-    return CrashUnlessFuzzing(isolate);
+  if (IsWasmModuleObject(object)) {
+    return Cast<WasmModuleObject>(object)->native_module();
   }
+  return nullptr;
+}
+
+}  // namespace
+
+RUNTIME_FUNCTION(Runtime_WasmNumCodeSpaces) {
+  HandleScope scope(isolate);
+  if (args.length() != 1) return CrashUnlessFuzzing(isolate);
+  wasm::NativeModule* native_module =
+      NativeModuleFromInstanceOrModule(isolate, args[0]);
+  if (!native_module) return CrashUnlessFuzzing(isolate);
   size_t num_spaces = native_module->GetNumberOfCodeSpacesForTesting();
   return *isolate->factory()->NewNumberFromSize(num_spaces);
 }
 
+RUNTIME_FUNCTION(Runtime_WasmUnusedCodeSpace) {
+  HandleScope scope(isolate);
+  if (args.length() != 1) return CrashUnlessFuzzing(isolate);
+  wasm::NativeModule* native_module =
+      NativeModuleFromInstanceOrModule(isolate, args[0]);
+  if (!native_module) return CrashUnlessFuzzing(isolate);
+  size_t unused_size = native_module->GetUnusedCodeSpaceSizeForTesting();
+  return *isolate->factory()->NewNumberFromSize(unused_size);
+}
+
 namespace {
 
 template <typename T1, typename T2 = T1>
@@ -12,6 +12,7 @@
 #include "src/api/api-inl.h"
 #include "src/base/macros.h"
 #include "src/base/numbers/double.h"
+#include "src/baseline/baseline-batch-compiler.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/pending-optimization-table.h"
 #include "src/compiler-dispatcher/lazy-compile-dispatcher.h"
@@ -42,6 +43,7 @@
 #include "src/objects/js-regexp-inl.h"
 #include "src/objects/smi.h"
 #include "src/profiler/heap-snapshot-generator.h"
+#include "src/regexp/regexp-concurrent-compiler.h"
 #include "src/regexp/regexp.h"
 #include "src/snapshot/snapshot.h"
 
@@ -529,6 +531,31 @@ RUNTIME_FUNCTION(Runtime_ActiveTierIsSparkplug) {
   return isolate->heap()->ToBoolean(function->ActiveTierIsBaseline(isolate));
 }
 
+// Compiles the function in a concurrent Sparkplug batch and waits for the
+// background job. Returns whether the function's code is installed before the
+// main thread gets to finalize the batch.
+RUNTIME_FUNCTION(Runtime_CompileBaselineInBackground) {
+  HandleScope scope(isolate);
+  if (args.length() != 1 || !IsJSFunction(args[0])) {
+    return CrashUnlessFuzzing(isolate);
+  }
+#ifdef V8_ENABLE_SPARKPLUG
+  DirectHandle<JSFunction> function = args.at<JSFunction>(0);
+  Tagged<SharedFunctionInfo> shared = function->shared();
+  if (!v8_flags.concurrent_sparkplug || !shared->is_compiled() ||
+      !shared->IsUserJavaScript()) {
+    return CrashUnlessFuzzing(isolate);
+  }
+  baseline::BaselineBatchCompiler* compiler =
+      isolate->baseline_batch_compiler();
+  compiler->EnqueueSFI(shared);
+  compiler->AwaitCompileJobsForTesting();
+  return isolate->heap()->ToBoolean(function->shared()->HasBaselineCode());
+#else
+  return CrashUnlessFuzzing(isolate);
+#endif  // V8_ENABLE_SPARKPLUG
+}
+
 RUNTIME_FUNCTION(Runtime_ActiveTierIsMaglev) {
   HandleScope scope(isolate);
   if (args.length() != 1 || !IsJSFunction(args[0])) {
@@ -1717,6 +1744,12 @@ RUNTIME_FUNCTION(Runtime_DisallowCodegenFromStrings) {
   return ReadOnlyRoots(isolate).undefined_value();
 }
 
+RUNTIME_FUNCTION(Runtime_RegexpFinishConcurrentTierUp) {
+  SealHandleScope shs(isolate);
+  isolate->regexp_concurrent_compiler()->FinishAllJobsForTesting();
+  return ReadOnlyRoots(isolate).undefined_value();
+}
+
 RUNTIME_FUNCTION(Runtime_RegexpHasBytecode) {
   SealHandleScope shs(isolate);
   if (args.length() != 2 || !IsJSRegExp(args[0]) || !IsBoolean(args[1])) {
@@ -2042,6 +2075,14 @@ RUNTIME_FUNCTION(Runtime_BigIntMaxLengthBits) {
   return *isolate->factory()->NewNumber(BigInt::kMaxLengthBits);
 }
 
+RUNTIME_FUNCTION(Runtime_JsonParseShapeCacheHits) {
+  int count = isolate->counters()
+                  ->json_parse_shape_cache_hits()
+                  ->GetInternalPointer()
+                  ->load();
+  return Smi::FromInt(count);
+}
+
 RUNTIME_FUNCTION(Runtime_IsSameHeapObject) {
   HandleScope scope(isolate);
   if (args.length() != 2 || !IsHeapObject(args[0]) || !IsHeapObject(args[1])) {
@@ -551,6 +551,7 @@ constexpr bool CanTriggerGC(T... properties) {
   F(CheckNoWriteBarrierNeeded, 2, 1)                                     \
   F(ClearFunctionFeedback, 1, 1)                                         \
   F(ClearMegamorphicStubCache, 0, 1)                                     \
+  F(CompileBaselineInBackground, 1, 1)                                   \
   F(CompleteInobjectSlackTracking, 1, 1)                                 \
   F(ConstructConsString, 2, 1)                                           \
   F(ConstructDouble, 2, 1)                                               \
@@ -628,6 +629,7 @@ constexpr bool CanTriggerGC(T... properties) {
   F(IsSparkplugEnabled, 0, 1)                                            \
   F(IsTurbofanEnabled, 0, 1)                                             \
   F(IsWasmTieringPredictable, 0, 1)                                      \
+  F(JsonParseShapeCacheHits, 0, 1)                                       \
   F(MapIteratorProtector, 0, 1)                                          \
   F(NeverOptimizeFunction, 1, 1)                                         \
   F(NewRegExpWithBacktrackLimit, 3, 1)                                   \
@@ -644,6 +646,7 @@ constexpr bool CanTriggerGC(T... properties) {
   F(PrintWithNameForAssert, 2, 1, RuntimeCallProperty::kCannotTriggerGC) \
   F(PromiseSpeciesProtector, 0, 1)                                       \
   F(RegExpSpeciesProtector, 0, 1)                                        \
+  F(RegexpFinishConcurrentTierUp, 0, 1)                                  \
   F(RegexpHasBytecode, 2, 1)                                             \
   F(RegexpHasNativeCode, 2, 1)                                           \
   F(RegexpIsUnmodified, 1, 1)                                            \
@@ -792,7 +795,8 @@ constexpr bool CanTriggerGC(T... properties) {
   F(WasmTraceEnter, 0, 1)                                       \
   F(WasmTraceExit, 1, 1)                                        \
   F(WasmTraceMemory, 1, 1)                                      \
-  F(WasmTriggerTierUpForTesting, 1, 1)
+  F(WasmTriggerTierUpForTesting, 1, 1)                          \
+  F(WasmUnusedCodeSpace, 1, 1)
 
 #define FOR_EACH_INTRINSIC_WASM_DRUMBRAKE_TEST(F, I) \
   F(WasmTraceBeginExecution, 0, 1)                   \
@@ -4203,6 +4203,16 @@ void LiftoffAssembler::set_trap_on_oob_mem64(Register index, uint64_t max_index,
   B(trap_label, kUnsignedGreaterThanEqual);
 }
 
+void LiftoffAssembler::clamp_oob_mem64(Register dst, Register index,
+                                       uint64_t max_index,
+                                       uint64_t clamped_index) {
+  UseScratchRegisterScope temps(this);
+  Register clamped = temps.AcquireX();
+  Mov(clamped, clamped_index);
+  Cmp(index.X(), max_index);
+  Csel(dst.X(), index.X(), clamped, lo);
+}
+
 void LiftoffAssembler::StackCheck(Label* ool_code) {
   UseScratchRegisterScope temps(this);
   Register limit_address = temps.AcquireX();
@@ -645,9 +645,18 @@ void LiftoffAssembler::Spill(VarState* slot) {
   slot->MakeStack();
 }
 
-void LiftoffAssembler::SpillLocals() {
+void LiftoffAssembler::SpillLocalsKeepingRegisters(int max_register_locals) {
   for (VarState& local_slot :
        base::VectorOf(cache_state_.stack_state.data(), num_locals_)) {
+    // A register shared with other values could not be updated when merging a
+    // new value of this local into the state. Keep it simple and also spill
+    // register pairs.
+    if (max_register_locals > 0 && local_slot.is_reg() &&
+        !local_slot.reg().is_pair() &&
+        cache_state_.get_use_count(local_slot.reg()) == 1) {
+      --max_register_locals;
+      continue;
+    }
     Spill(&local_slot);
   }
 }
@@ -569,7 +569,9 @@ class LiftoffAssembler : public MacroAssembler {
   void MergeStackWith(CacheState& target, uint32_t arity, JumpDirection);
 
   void Spill(VarState* slot);
-  void SpillLocals();
+  // Spills all locals, except for up to {max_register_locals} locals cached in
+  // registers that hold no other value.
+  void SpillLocalsKeepingRegisters(int max_register_locals);
   void SpillAllRegisters();
   inline void LoadSpillAddress(Register dst, int offset, ValueKind kind);
 
@@ -1525,6 +1527,9 @@ class LiftoffAssembler : public MacroAssembler {
 
   inline void set_trap_on_oob_mem64(Register index, uint64_t max_index,
                                     Label* trap_label);
+  // Sets {dst} to {index} if {index < max_index}, to {clamped_index} otherwise.
+  inline void clamp_oob_mem64(Register dst, Register index, uint64_t max_index,
+                              uint64_t clamped_index);
 
   inline void StackCheck(Label* ool_code);
 
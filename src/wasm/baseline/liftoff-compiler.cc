@@ -1401,13 +1401,31 @@ class LiftoffCompiler {
 
   void Block(FullDecoder* decoder, Control* block) { PushControl(block); }
 
+  // Returns how many locals can stay in their registers when entering the loop
+  // at the current pc. This is only done for innermost loops without calls,
+  // which otherwise spill all registers anyway.
+  int MaxRegisterLocalsInLoop(FullDecoder* decoder) {
+    if (for_debugging_) return 0;
+    if (v8_flags.wasm_liftoff_loop_register_locals == 0) return 0;
+    bool is_innermost = false;
+    BitVector* assigned = WasmDecoder<ValidationTag>::AnalyzeLoopAssignment(
+        decoder, decoder->pc(), decoder->num_locals(), decoder->zone(),
+        &is_innermost);
+    // The extra bit in {assigned} is set if the loop contains calls.
+    if (!assigned || !is_innermost ||
+        assigned->Contains(decoder->num_locals())) {
+      return 0;
+    }
+    return v8_flags.wasm_liftoff_loop_register_locals;
+  }
+
   void Loop(FullDecoder* decoder, Control* loop) {
-    // Before entering a loop, spill all locals to the stack, in order to free
-    // the cache registers, and to avoid unnecessarily reloading stack values
-    // into registers at branches.
-    // TODO(clemensb): Come up with a better strategy here, involving
-    // pre-analysis of the function.
-    __ SpillLocals();
+    // Before entering a loop, spill locals to the stack, in order to free the
+    // cache registers, and to avoid unnecessarily reloading stack values into
+    // registers at branches. Small inner loops keep a few locals in registers,
+    // so that back edges only need register moves instead of a spill and a
+    // reload per iteration.
+    __ SpillLocalsKeepingRegisters(MaxRegisterLocalsInLoop(decoder));
 
     __ SpillLoopArgs(loop->start_merge.arity);
 
@@ -3495,7 +3513,24 @@ class LiftoffCompiler {
 #if V8_TRAP_HANDLER_SUPPORTED
     if (use_trap_handler) {
 #if V8_TARGET_ARCH_ARM64 || V8_TARGET_ARCH_X64
-      if (memory->is_memory64()) {
+      if (memory->is_memory64() &&
+          v8_flags.wasm_memory64_clamp_bounds_checks) {
+        SCOPED_CODE_COMMENT("clamp memory index");
+        // Redirect out-of-bounds accesses to `kMaxMemory64Size`, into the
+        // guard region reserved behind the maximum memory size. The index
+        // register might still be used by other stack slots, so clamp into a
+        // fresh register in that case.
+        Register clamped_index = index_ptrsize;
+        if (__ cache_state()->is_used(LiftoffRegister{index_ptrsize})) {
+          clamped_index =
+              __ GetUnusedRegister(kGpReg, pinned | LiftoffRegList{index})
+                  .gp();
+        }
+        __ clamp_oob_mem64(clamped_index, index_ptrsize,
+                           kMaxMemory64Size - end_offset,
+                           kMaxMemory64Size - offset);
+        return clamped_index;
+      } else if (memory->is_memory64()) {
         FREEZE_STATE(trapping);
         OolTrapLabel trap =
             AddOutOfLineTrap(decoder, Builtin::kThrowWasmTrapMemOutOfBounds);
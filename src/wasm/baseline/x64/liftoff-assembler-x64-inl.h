@@ -4739,6 +4739,21 @@ void LiftoffAssembler::set_trap_on_oob_mem64(Register index, uint64_t max_index,
   j(above_equal, trap_label);
 }
 
+void LiftoffAssembler::clamp_oob_mem64(Register dst, Register index,
+                                       uint64_t max_index,
+                                       uint64_t clamped_index) {
+  if (is_uint31(max_index)) {
+    cmpq(index, Immediate(static_cast<int32_t>(max_index)));
+  } else {
+    movq(kScratchRegister, Immediate64(max_index));
+    cmpq(index, kScratchRegister);
+  }
+  // Moves do not change the flags.
+  if (dst != index) movq(dst, index);
+  movq(kScratchRegister, Immediate64(clamped_index));
+  cmovq(above_equal, dst, kScratchRegister);
+}
+
 void LiftoffAssembler::StackCheck(Label* ool_code) {
   cmpq(rsp, StackLimitAsOperand(StackLimitKind::kInterruptStackLimit));
   j(below_equal, ool_code);
@@ -24,6 +24,7 @@
 #include <cstring>
 #include <iomanip>
 #include <iostream>
+#include <optional>
 
 #include "include/libplatform/libplatform.h"
 #include "include/v8-initialization.h"
@@ -1801,83 +1802,127 @@ i::DirectHandle<i::JSReceiver> GetProperException(
       isolate->factory()->NewError(isolate->error_function(), string));
 }
 
+// Holds everything needed to call a function, so that the setup can be shared
+// by a batch of calls. Exported Wasm functions are called through their
+// C-to-Wasm entry stub, with the arguments packed into a single buffer that is
+// reused for all calls.
+class FuncCall {
+ public:
+  FuncCall(StoreImpl* store, i::DirectHandle<i::JSFunction> function)
+      : store_(store), isolate_(store->i_isolate()) {
+    i::Tagged<i::Object> raw_function_data =
+        function->shared()->GetTrustedData(isolate_);
+
+    // WasmCapiFunctions can be called directly.
+    if (IsWasmCapiFunctionData(raw_function_data)) {
+      capi_data_ = i::direct_handle(
+          i::Cast<i::WasmCapiFunctionData>(raw_function_data), isolate_);
+      return;
+    }
+
+    SBXCHECK(IsWasmExportedFunctionData(raw_function_data));
+    i::DirectHandle<i::WasmExportedFunctionData> function_data{
+        i::Cast<i::WasmExportedFunctionData>(raw_function_data), isolate_};
+    i::DirectHandle<i::WasmTrustedInstanceData> instance_data{
+        function_data->instance_data(), isolate_};
+    int function_index = function_data->function_index();
+    const i::wasm::WasmModule* module = instance_data->module();
+    sig_ = i::wasm::GetTypeCanonicalizer()->LookupFunctionSignature(
+        module->canonical_sig_id(module->functions[function_index].sig_index));
+    PrepareFunctionData(isolate_, function_data, sig_);
+    wrapper_code_ = i::direct_handle(function_data->c_wrapper_code(isolate_),
+                                     isolate_);
+    call_target_ = function_data->internal()->call_target();
+    packer_.emplace(function_data->packed_args_size());
+
+    if (function_index < static_cast<int>(module->num_imported_functions)) {
+      object_ref_ = i::direct_handle(
+          instance_data->dispatch_table_for_imports()->implicit_arg(
+              function_index),
+          isolate_);
+      if (IsWasmImportData(*object_ref_)) {
+        i::Tagged<i::JSFunction> jsfunc = i::Cast<i::JSFunction>(
+            i::Cast<i::WasmImportData>(*object_ref_)->callable());
+        i::Tagged<i::Object> data = jsfunc->shared()->GetTrustedData(isolate_);
+        if (IsWasmCapiFunctionData(data)) {
+          capi_data_ = i::direct_handle(
+              i::Cast<i::WasmCapiFunctionData>(data), isolate_);
+          return;
+        }
+        // TODO(jkummerow): Imported and then re-exported JavaScript functions
+        // are not supported yet. If we support C-API + JavaScript, we'll need
+        // to call those here.
+        UNIMPLEMENTED();
+      } else {
+        // A WasmFunction from another module.
+        DCHECK(IsWasmInstanceObject(*object_ref_));
+      }
+    } else {
+      // TODO(42204563): Avoid crashing if the instance object is not
+      // available.
+      CHECK(instance_data->has_instance_object());
+      object_ref_ = direct_handle(instance_data->instance_object(), isolate_);
+    }
+  }
+
+  own<Trap> Run(const vec<Val>& args, vec<Val>& results) {
+    if (!capi_data_.is_null()) {
+      return CallWasmCapiFunction(*capi_data_, args, results);
+    }
+
+    packer_->Reset();
+    PushArgs(sig_, args, &packer_.value(), store_);
+
+    i::Execution::CallWasm(isolate_, wrapper_code_, call_target_, object_ref_,
+                           packer_->argv());
+
+    if (isolate_->has_exception()) {
+      i::DirectHandle<i::Object> exception(isolate_->exception(), isolate_);
+      isolate_->clear_exception();
+      return implement<Trap>::type::make(
+          store_, GetProperException(isolate_, exception));
+    }
+
+    PopArgs(sig_, results, &packer_.value(), store_);
+    return nullptr;
+  }
+
+ private:
+  StoreImpl* const store_;
+  i::Isolate* const isolate_;
+  // Set if the call goes directly to a C-API callback.
+  i::DirectHandle<i::WasmCapiFunctionData> capi_data_;
+  const i::wasm::CanonicalSig* sig_ = nullptr;
+  i::DirectHandle<i::Code> wrapper_code_;
+  i::WasmCodePointer call_target_;
+  i::DirectHandle<i::Object> object_ref_;
+  std::optional<i::wasm::CWasmArgumentsPacker> packer_;
+};
+
 }  // namespace
 
 WASM_EXPORT auto Func::call(const vec<Val>& args, vec<Val>& results) const
     -> own<Trap> {
   auto func = impl(this);
   auto store = func->store();
+  v8::Isolate::Scope isolate_scope(store->isolate());
+  i::HandleScope handle_scope(store->i_isolate());
+  return FuncCall(store, func->v8_object()).Run(args, results);
+}
+
+WASM_EXPORT auto Func::call_batch(size_t count, const vec<Val> args[],
+                                  vec<Val> results[]) const -> own<Trap> {
+  auto func = impl(this);
+  auto store = func->store();
   auto isolate = store->i_isolate();
   v8::Isolate::Scope isolate_scope(store->isolate());
   i::HandleScope handle_scope(isolate);
-  i::Tagged<i::Object> raw_function_data =
-      func->v8_object()->shared()->GetTrustedData(isolate);
-
-  // WasmCapiFunctions can be called directly.
-  if (IsWasmCapiFunctionData(raw_function_data)) {
-    return CallWasmCapiFunction(
-        i::Cast<i::WasmCapiFunctionData>(raw_function_data), args, results);
-  }
-
-  SBXCHECK(IsWasmExportedFunctionData(raw_function_data));
-  i::DirectHandle<i::WasmExportedFunctionData> function_data{
-      i::Cast<i::WasmExportedFunctionData>(raw_function_data), isolate};
-  i::DirectHandle<i::WasmTrustedInstanceData> instance_data{
-      function_data->instance_data(), isolate};
-  int function_index = function_data->function_index();
-  const i::wasm::WasmModule* module = instance_data->module();
-  // Caching {sig} would reduce overhead substantially.
-  const i::wasm::CanonicalSig* sig =
-      i::wasm::GetTypeCanonicalizer()->LookupFunctionSignature(
-          module->canonical_sig_id(
-              module->functions[function_index].sig_index));
-  PrepareFunctionData(isolate, function_data, sig);
-  i::DirectHandle<i::Code> wrapper_code(function_data->c_wrapper_code(isolate),
-                                        isolate);
-  i::WasmCodePointer call_target = function_data->internal()->call_target();
-
-  i::wasm::CWasmArgumentsPacker packer(function_data->packed_args_size());
-  PushArgs(sig, args, &packer, store);
-
-  i::DirectHandle<i::Object> object_ref;
-  if (function_index < static_cast<int>(module->num_imported_functions)) {
-    object_ref = i::direct_handle(
-        instance_data->dispatch_table_for_imports()->implicit_arg(
-            function_index),
-        isolate);
-    if (IsWasmImportData(*object_ref)) {
-      i::Tagged<i::JSFunction> jsfunc = i::Cast<i::JSFunction>(
-          i::Cast<i::WasmImportData>(*object_ref)->callable());
-      i::Tagged<i::Object> data = jsfunc->shared()->GetTrustedData(isolate);
-      if (IsWasmCapiFunctionData(data)) {
-        return CallWasmCapiFunction(i::Cast<i::WasmCapiFunctionData>(data),
-                                    args, results);
-      }
-      // TODO(jkummerow): Imported and then re-exported JavaScript functions
-      // are not supported yet. If we support C-API + JavaScript, we'll need
-      // to call those here.
-      UNIMPLEMENTED();
-    } else {
-      // A WasmFunction from another module.
-      DCHECK(IsWasmInstanceObject(*object_ref));
-    }
-  } else {
-    // TODO(42204563): Avoid crashing if the instance object is not available.
-    CHECK(instance_data->has_instance_object());
-    object_ref = direct_handle(instance_data->instance_object(), isolate);
-  }
-
-  i::Execution::CallWasm(isolate, wrapper_code, call_target, object_ref,
-                         packer.argv());
-
-  if (isolate->has_exception()) {
-    i::DirectHandle<i::Object> exception(isolate->exception(), isolate);
-    isolate->clear_exception();
-    return implement<Trap>::type::make(store,
-                                       GetProperException(isolate, exception));
+  FuncCall call(store, func->v8_object());
+  for (size_t i = 0; i < count; ++i) {
+    // Reference results allocate handles, so release them after each call.
+    i::HandleScope call_scope(isolate);
+    if (own<Trap> trap = call.Run(args[i], results[i])) return trap;
   }
-
-  PopArgs(sig, results, &packer, store);
   return nullptr;
 }
 
@@ -3325,6 +3370,17 @@ WASM_API_EXTERN wasm_trap_t* wasm_func_call(const wasm_func_t* func,
   return ret;
 }
 
+WASM_API_EXTERN wasm_trap_t* wasm_func_call_batch(const wasm_func_t* func,
+                                                  size_t count,
+                                                  const wasm_val_vec_t args[],
+                                                  wasm_val_vec_t results[]) {
+  // The vectors have the same layout in C and C++ (see {hide_val_vec}), so
+  // the arrays can be passed through without copying.
+  return release_trap(func->call_batch(
+      count, reinterpret_cast<const wasm::vec<wasm::Val>*>(args),
+      reinterpret_cast<wasm::vec<wasm::Val>*>(results)));
+}
+
 // Global Instances
 
 WASM_DEFINE_REF(global, wasm::Global)
@@ -763,6 +763,71 @@
   V(s2s_BranchIf)                               \
   V(r2s_BranchIfWithParams)                     \
   V(s2s_BranchIfWithParams)                     \
+  /* Comparison_BranchIf */                     \
+  V(r2s_I32Eq_BranchIf)                         \
+  V(r2s_I32Ne_BranchIf)                         \
+  V(r2s_I32LtU_BranchIf)                        \
+  V(r2s_I32LeU_BranchIf)                        \
+  V(r2s_I32GtU_BranchIf)                        \
+  V(r2s_I32GeU_BranchIf)                        \
+  V(r2s_I32LtS_BranchIf)                        \
+  V(r2s_I32LeS_BranchIf)                        \
+  V(r2s_I32GtS_BranchIf)                        \
+  V(r2s_I32GeS_BranchIf)                        \
+  V(r2s_I64Eq_BranchIf)                         \
+  V(r2s_I64Ne_BranchIf)                         \
+  V(r2s_I64LtU_BranchIf)                        \
+  V(r2s_I64LeU_BranchIf)                        \
+  V(r2s_I64GtU_BranchIf)                        \
+  V(r2s_I64GeU_BranchIf)                        \
+  V(r2s_I64LtS_BranchIf)                        \
+  V(r2s_I64LeS_BranchIf)                        \
+  V(r2s_I64GtS_BranchIf)                        \
+  V(r2s_I64GeS_BranchIf)                        \
+  V(r2s_F32Eq_BranchIf)                         \
+  V(r2s_F32Ne_BranchIf)                         \
+  V(r2s_F32Lt_BranchIf)                         \
+  V(r2s_F32Le_BranchIf)                         \
+  V(r2s_F32Gt_BranchIf)                         \
+  V(r2s_F32Ge_BranchIf)                         \
+  V(r2s_F64Eq_BranchIf)                         \
+  V(r2s_F64Ne_BranchIf)                         \
+  V(r2s_F64Lt_BranchIf)                         \
+  V(r2s_F64Le_BranchIf)                         \
+  V(r2s_F64Gt_BranchIf)                         \
+  V(r2s_F64Ge_BranchIf)                         \
+  V(s2s_I32Eq_BranchIf)                         \
+  V(s2s_I32Ne_BranchIf)                         \
+  V(s2s_I32LtU_BranchIf)                        \
+  V(s2s_I32LeU_BranchIf)                        \
+  V(s2s_I32GtU_BranchIf)                        \
+  V(s2s_I32GeU_BranchIf)                        \
+  V(s2s_I32LtS_BranchIf)                        \
+  V(s2s_I32LeS_BranchIf)                        \
+  V(s2s_I32GtS_BranchIf)                        \
+  V(s2s_I32GeS_BranchIf)                        \
+  V(s2s_I64Eq_BranchIf)                         \
+  V(s2s_I64Ne_BranchIf)                         \
+  V(s2s_I64LtU_BranchIf)                        \
+  V(s2s_I64LeU_BranchIf)                        \
+  V(s2s_I64GtU_BranchIf)                        \
+  V(s2s_I64GeU_BranchIf)                        \
+  V(s2s_I64LtS_BranchIf)                        \
+  V(s2s_I64LeS_BranchIf)                        \
+  V(s2s_I64GtS_BranchIf)                        \
+  V(s2s_I64GeS_BranchIf)                        \
+  V(s2s_F32Eq_BranchIf)                         \
+  V(s2s_F32Ne_BranchIf)                         \
+  V(s2s_F32Lt_BranchIf)                         \
+  V(s2s_F32Le_BranchIf)                         \
+  V(s2s_F32Gt_BranchIf)                         \
+  V(s2s_F32Ge_BranchIf)                         \
+  V(s2s_F64Eq_BranchIf)                         \
+  V(s2s_F64Ne_BranchIf)                         \
+  V(s2s_F64Lt_BranchIf)                         \
+  V(s2s_F64Le_BranchIf)                         \
+  V(s2s_F64Gt_BranchIf)                         \
+  V(s2s_F64Ge_BranchIf)                         \
   V(r2s_If)                                     \
   V(s2s_If)                                     \
   V(s2s_Else)                                   \
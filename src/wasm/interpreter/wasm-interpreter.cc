@@ -2266,6 +2266,38 @@ class Handlers : public HandlersBase {
   FOREACH_COMPARISON_BINOP(DEFINE_BINOP)
 #undef DEFINE_BINOP
 
+  //////////////////////////////////////////////////////////////////////////////
+  // Comparison operators followed by br_if
+
+#define DEFINE_BINOP(name, ctype, reg, op, type)                               \
+  INSTRUCTION_HANDLER_FUNC r2s_##name##_BranchIf(                              \
+      const uint8_t* code, uint32_t* sp, WasmInterpreterRuntime* wasm_runtime, \
+      int64_t r0, double fp0) {                                                \
+    ctype rval = static_cast<ctype>(reg);                                      \
+    ctype lval = pop<ctype>(sp, code, wasm_runtime);                           \
+                                                                               \
+    int32_t if_true_offset = Read<int32_t>(code);                              \
+    if (lval op rval) {                                                        \
+      code += (if_true_offset - kCodeOffsetSize);                              \
+    }                                                                          \
+    NextOp();                                                                  \
+  }                                                                            \
+                                                                               \
+  INSTRUCTION_HANDLER_FUNC s2s_##name##_BranchIf(                              \
+      const uint8_t* code, uint32_t* sp, WasmInterpreterRuntime* wasm_runtime, \
+      int64_t r0, double fp0) {                                                \
+    ctype rval = pop<ctype>(sp, code, wasm_runtime);                           \
+    ctype lval = pop<ctype>(sp, code, wasm_runtime);                           \
+                                                                               \
+    int32_t if_true_offset = Read<int32_t>(code);                              \
+    if (lval op rval) {                                                        \
+      code += (if_true_offset - kCodeOffsetSize);                              \
+    }                                                                          \
+    NextOp();                                                                  \
+  }
+  FOREACH_COMPARISON_BINOP(DEFINE_BINOP)
+#undef DEFINE_BINOP
+
   //////////////////////////////////////////////////////////////////////////////
   // More binary operators
 
@@ -12923,6 +12955,30 @@ bool WasmBytecodeGenerator::DoEncodeSuperInstruction(
         reg_mode = RegMode::kNoReg;
         return true;
       }
+      default:
+        return false;
+    }
+  } else if (next_instr.orig == kExprBrIf &&
+             HasVoidSignature(
+                 blocks_[GetTargetBranch(next_instr.optional.depth)])) {
+    switch (curr_instr.orig) {
+#define BRANCH_IF_CASE(name, ctype, reg, op, type) \
+  case kExpr##name: {                              \
+    if (reg_mode == RegMode::kNoReg) {             \
+      EMIT_INSTR_HANDLER(s2s_##name##_BranchIf);   \
+      type##Pop();                                 \
+      type##Pop();                                 \
+    } else {                                       \
+      EMIT_INSTR_HANDLER(r2s_##name##_BranchIf);   \
+      type##Pop();                                 \
+    }                                              \
+    EmitBranchOffset(next_instr.optional.depth);   \
+    reg_mode = RegMode::kNoReg;                    \
+    return true;                                   \
+  }
+      FOREACH_COMPARISON_BINOP(BRANCH_IF_CASE)
+#undef BRANCH_IF_CASE
+
       default:
         return false;
     }
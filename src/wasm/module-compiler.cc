@@ -2644,8 +2644,12 @@ class AsyncStreamingProcessor final : public StreamingProcessor {
   bool Deserialize(base::Vector<const uint8_t> wire_bytes,
                    base::Vector<const uint8_t> module_bytes) override;
 
+  bool DeserializeFromFileCache(
+      base::Vector<const uint8_t> wire_bytes) override;
+
  private:
   void CommitCompilationUnits();
+  bool FinishDeserialization(MaybeDirectHandle<WasmModuleObject> result);
 
   ModuleDecoder decoder_;
   AsyncCompileJob* job_;
@@ -2750,7 +2754,10 @@ void AsyncCompileJob::FinishCompile(bool is_after_cache_hit) {
   USE(compilation_state->UpdateDetectedFeatures(detected_features_));
 
   // If experimental PGO via files is enabled, load profile information now that
-  // we have all wire bytes and know that the module is valid.
+  // we have all wire bytes and know that the module is valid. Streaming
+  // compilation might already have scheduled compilation based on the profile,
+  // but type feedback is only restored here, after checking the hash of the
+  // full wire bytes.
   if (V8_UNLIKELY(v8_flags.experimental_wasm_pgo_from_file)) {
     std::unique_ptr<ProfileInformation> pgo_info =
         LoadProfileFromFile(module, native_module_->wire_bytes());
@@ -3316,10 +3323,21 @@ bool AsyncStreamingProcessor::ProcessCodeSectionHeader(
   // Set outstanding_finishers_ to 2, because both the AsyncCompileJob and the
   // AsyncStreamingProcessor have to finish.
   job_->outstanding_finishers_.store(2);
-  // TODO(13209): Use PGO for streaming compilation, if available.
-  constexpr ProfileInformation* kNoProfileInformation = nullptr;
+  // If experimental PGO via files is enabled, load profile information before
+  // the first function body arrives. Functions that were tiered up in the
+  // profiling run then get their TurboFan units scheduled directly from
+  // {ProcessFunctionBody}, so their code is available at instantiation.
+  // Only the module prefix can be checked at this point, so this only affects
+  // which tiers get compiled; type feedback is restored in {FinishCompile}.
+  // Functions with type feedback are only tiered up from there, so that their
+  // TurboFan code can use the feedback.
+  std::unique_ptr<ProfileInformation> pgo_info;
+  if (V8_UNLIKELY(v8_flags.experimental_wasm_pgo_from_file)) {
+    pgo_info = LoadProfileForStreaming(job_->native_module_->module(),
+                                       prefix_hasher_.hash());
+  }
   compilation_unit_builder_ = InitializeCompilation(
-      job_->isolate(), job_->native_module_.get(), kNoProfileInformation);
+      job_->isolate(), job_->native_module_.get(), pgo_info.get());
   return true;
 }
 
@@ -3546,10 +3564,22 @@ bool AsyncStreamingProcessor::Deserialize(
   HandleScope scope(job_->isolate_);
   SaveAndSwitchContext saved_context(job_->isolate_, *job_->native_context_);
 
-  MaybeDirectHandle<WasmModuleObject> result = DeserializeNativeModule(
+  return FinishDeserialization(DeserializeNativeModule(
       job_->isolate_, module_bytes, wire_bytes, job_->compile_imports_,
-      base::VectorOf(job_->stream_->url()));
+      base::VectorOf(job_->stream_->url())));
+}
+
+bool AsyncStreamingProcessor::DeserializeFromFileCache(
+    base::Vector<const uint8_t> wire_bytes) {
+  if (!UseNativeModuleFileCache(job_->compile_imports_)) return false;
+  HandleScope scope(job_->isolate_);
+  SaveAndSwitchContext saved_context(job_->isolate_, *job_->native_context_);
+  return FinishDeserialization(DeserializeNativeModuleFromFileCache(
+      job_->isolate_, wire_bytes, base::VectorOf(job_->stream_->url())));
+}
 
+bool AsyncStreamingProcessor::FinishDeserialization(
+    MaybeDirectHandle<WasmModuleObject> result) {
   if (result.is_null()) return false;
 
   job_->module_object_ =
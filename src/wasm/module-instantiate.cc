@@ -270,7 +270,8 @@ bool IsSupportedWasmFastApiFunction(Isolate* isolate,
 }
 
 bool ResolveBoundJSFastApiFunction(const wasm::CanonicalSig* expected_sig,
-                                   DirectHandle<JSReceiver> callable) {
+                                   DirectHandle<JSReceiver> callable,
+                                   int* out_api_function_index) {
   Isolate* isolate = Isolate::Current();
 
   DirectHandle<JSFunction> target;
@@ -296,14 +297,11 @@ bool ResolveBoundJSFastApiFunction(const wasm::CanonicalSig* expected_sig,
   }
 
   DirectHandle<SharedFunctionInfo> shared(target->shared(), isolate);
-  int api_function_index = -1;
-  // The fast API call wrapper currently does not support function overloading.
-  // Therefore, if the matching function is not function 0, the fast API cannot
-  // be used.
+  // Of several C function overloads, pick the one matching the signature of
+  // the import; the wrapper then calls that overload directly.
   return IsSupportedWasmFastApiFunction(isolate, expected_sig, *shared,
                                         ReceiverKind::kAnyReceiver,
-                                        &api_function_index) &&
-         api_function_index == 0;
+                                        out_api_function_index);
 }
 
 bool IsStringRef(wasm::CanonicalValueType type) {
@@ -448,9 +446,10 @@ WellKnownImport CheckForWellKnownImport(
       return kGeneric;
     }
 #ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
-    Address c_functions[] = {func_data->GetCFunction(isolate, 0)};
+    Address c_functions[] = {
+        func_data->GetCFunction(isolate, out_api_function_index)};
     const v8::CFunctionInfo* const c_signatures[] = {
-        func_data->GetCSignature(isolate, 0)};
+        func_data->GetCSignature(isolate, out_api_function_index)};
     isolate->simulator_data()->RegisterFunctionsAndSignatures(c_functions,
                                                               c_signatures, 1);
 #endif  //  V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
@@ -764,7 +763,8 @@ ImportCallKind ResolvedWasmImport::ComputeKind(
   }
   // Check if this can be a JS fast API call.
   if (v8_flags.turbo_fast_api_calls &&
-      ResolveBoundJSFastApiFunction(expected_sig, callable_)) {
+      ResolveBoundJSFastApiFunction(expected_sig, callable_,
+                                    &fast_api_function_index_)) {
     return ImportCallKind::kWasmToJSFastApi;
   }
   well_known_status_ = CheckForWellKnownImport(
@@ -2088,11 +2088,97 @@ MaybeDirectHandle<Object> InstanceBuilder::LookupImportAsm(
   }
 }
 
-// Load data segments into the memory.
+namespace {
+
+// A pending copy of (a part of) an active data segment into memory.
+struct DataSegmentCopy {
+  uint8_t* dst;
+  const uint8_t* src;
+  size_t size;
+};
+
+// Copies large data segments in chunks of this size, so that the work can be
+// distributed over multiple threads.
+constexpr size_t kDataSegmentChunkSize = 256 * KB;
+
+// A job that copies data segment chunks in parallel.
+class CopyDataSegmentsJob final : public JobTask {
+ public:
+  explicit CopyDataSegmentsJob(std::vector<DataSegmentCopy> chunks)
+      : chunks_(std::move(chunks)) {}
+
+  void Run(JobDelegate* delegate) override {
+    TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.wasm.detailed"),
+                 "wasm.CopyDataSegments");
+    do {
+      size_t index = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= chunks_.size()) return;
+      const DataSegmentCopy& chunk = chunks_[index];
+      std::memcpy(chunk.dst, chunk.src, chunk.size);
+    } while (!delegate->ShouldYield());
+  }
+
+  size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+    size_t next_chunk = next_chunk_.load(std::memory_order_relaxed);
+    return chunks_.size() - std::min(next_chunk, chunks_.size());
+  }
+
+ private:
+  const std::vector<DataSegmentCopy> chunks_;
+  std::atomic<size_t> next_chunk_{0};
+};
+
+// Later data segments overwrite earlier ones, so overlapping segments must be
+// copied in order.
+bool HaveOverlappingDestinations(std::vector<DataSegmentCopy> copies) {
+  std::sort(copies.begin(), copies.end(),
+            [](const DataSegmentCopy& a, const DataSegmentCopy& b) {
+              return a.dst < b.dst;
+            });
+  for (size_t i = 1; i < copies.size(); ++i) {
+    if (copies[i - 1].dst + copies[i - 1].size > copies[i].dst) return true;
+  }
+  return false;
+}
+
+void CopyDataSegments(const std::vector<DataSegmentCopy>& copies,
+                      size_t total_size) {
+  if (!v8_flags.wasm_parallel_data_segments ||
+      total_size < v8_flags.wasm_parallel_data_segments_min_kb * KB ||
+      HaveOverlappingDestinations(copies)) {
+    for (const DataSegmentCopy& copy : copies) {
+      std::memcpy(copy.dst, copy.src, copy.size);
+    }
+    return;
+  }
+
+  std::vector<DataSegmentCopy> chunks;
+  chunks.reserve(total_size / kDataSegmentChunkSize + copies.size());
+  for (const DataSegmentCopy& copy : copies) {
+    for (size_t offset = 0; offset < copy.size;
+         offset += kDataSegmentChunkSize) {
+      size_t chunk_size = std::min(kDataSegmentChunkSize, copy.size - offset);
+      chunks.push_back({copy.dst + offset, copy.src + offset, chunk_size});
+    }
+  }
+  // The main thread joins the job, so it participates in copying.
+  std::unique_ptr<JobHandle> job_handle = V8::GetCurrentPlatform()->CreateJob(
+      TaskPriority::kUserBlocking,
+      std::make_unique<CopyDataSegmentsJob>(std::move(chunks)));
+  job_handle->Join();
+}
+
+}  // namespace
+
+// Load data segments into the memory. All segments are bounds-checked first,
+// then the segments before the first failing one are copied, on multiple
+// threads if they are large.
 // TODO(14616): Consider what to do with shared memories.
 void InstanceBuilder::LoadDataSegments() {
   base::Vector<const uint8_t> wire_bytes =
       module_object_->native_module()->wire_bytes();
+  std::vector<DataSegmentCopy> copies;
+  size_t total_size = 0;
   for (const WasmDataSegment& segment : module_->data_segments) {
     uint32_t size = segment.source.length();
 
@@ -2105,7 +2191,7 @@ void InstanceBuilder::LoadDataSegments() {
         &init_expr_zone_, segment.dest_addr,
         dst_memory.is_memory64() ? kWasmI64 : kWasmI32, module_, isolate_,
         trusted_data_, shared_trusted_data_);
-    if (MaybeMarkError(result, thrower_)) return;
+    if (MaybeMarkError(result, thrower_)) break;
     if (dst_memory.is_memory64()) {
       uint64_t dest_offset_64 = to_value(result).to_u64();
 
@@ -2125,13 +2211,15 @@ void InstanceBuilder::LoadDataSegments() {
           "data segment %zu is out of bounds (offset %zu, "
           "length %u, memory size %zu)",
           segment_index, dest_offset, size, memory_size);
-      return;
+      break;
     }
 
     uint8_t* memory_base = trusted_data_->memory_base(segment.memory_index);
-    std::memcpy(memory_base + dest_offset,
-                wire_bytes.begin() + segment.source.offset(), size);
+    copies.push_back({memory_base + dest_offset,
+                      wire_bytes.begin() + segment.source.offset(), size});
+    total_size += size;
   }
+  CopyDataSegments(copies, total_size);
 }
 
 void InstanceBuilder::WriteGlobalValue(const WasmGlobal& global,
@@ -2362,7 +2450,8 @@ bool InstanceBuilder::ProcessImportedFunction(
 
       std::shared_ptr<wasm::WasmImportWrapperHandle> wrapper_handle =
           GetWasmImportWrapperCache()->CompileWasmJsFastCallWrapper(
-              isolate_, callable, expected_sig);
+              isolate_, callable, resolved.fast_api_function_index(),
+              expected_sig);
 
       imported_entry.SetWasmToWrapper(isolate_, callable,
                                       std::move(wrapper_handle), kNoSuspend,
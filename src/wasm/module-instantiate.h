@@ -72,6 +72,9 @@ class ResolvedWasmImport {
   WellKnownImport well_known_status() const { return well_known_status_; }
   Suspend suspend() const { return suspend_; }
   DirectHandle<JSReceiver> callable() const { return callable_; }
+  // For {ImportCallKind::kWasmToJSFastApi}: the index of the C function
+  // overload that matches the import's signature.
+  int fast_api_function_index() const { return fast_api_function_index_; }
   // Avoid reading function data from the result of `callable()`, because it
   // might have been corrupted in the meantime (in a compromised sandbox).
   // Instead, use this cached copy.
@@ -92,6 +95,7 @@ class ResolvedWasmImport {
   ImportCallKind kind_;
   WellKnownImport well_known_status_{WellKnownImport::kGeneric};
   Suspend suspend_{kNoSuspend};
+  int fast_api_function_index_{-1};
   DirectHandle<JSReceiver> callable_;
   DirectHandle<WasmFunctionData> trusted_function_data_;
 };
@@ -4,7 +4,10 @@
 
 #include "src/wasm/pgo.h"
 
+#include <optional>
+
 #include "src/wasm/decoder.h"
+#include "src/wasm/wasm-engine.h"  // For {NativeModuleCache::PrefixHash}.
 #include "src/wasm/wasm-module-builder.h"  // For {ZoneBuffer}.
 
 namespace v8::internal::wasm {
@@ -20,9 +23,11 @@ class ProfileGenerator {
         type_feedback_mutex_guard_(&module->type_feedback.mutex),
         tiering_budget_array_(tiering_budget_array) {}
 
-  base::OwnedVector<uint8_t> GetProfileData() {
+  base::OwnedVector<uint8_t> GetProfileData(
+      base::Vector<const uint8_t> wire_bytes) {
     ZoneBuffer buffer{&zone_};
 
+    SerializeHeader(buffer, wire_bytes);
     SerializeTypeFeedback(buffer);
     SerializeTieringInfo(buffer);
 
@@ -30,6 +35,16 @@ class ProfileGenerator {
   }
 
  private:
+  // The header identifies the module the profile was generated for (see
+  // {ReadAndCheckHeader}).
+  void SerializeHeader(ZoneBuffer& buffer,
+                       base::Vector<const uint8_t> wire_bytes) {
+    buffer.write_u64v(GetWireBytesHash(wire_bytes));
+    buffer.write_u64v(NativeModuleCache::PrefixHash(wire_bytes));
+    buffer.write_u32v(static_cast<uint32_t>(wire_bytes.size()));
+    buffer.write_u32v(module_->num_declared_functions);
+  }
+
   void SerializeTypeFeedback(ZoneBuffer& buffer) {
     const std::unordered_map<uint32_t, FunctionTypeFeedback>&
         feedback_for_function = module_->type_feedback.feedback_for_function;
@@ -102,19 +117,64 @@ class ProfileGenerator {
   const std::atomic<uint32_t>* const tiering_budget_array_;
 };
 
-void DeserializeTypeFeedback(Decoder& decoder, const WasmModule* module) {
-  base::MutexGuard mutex_guard{&module->type_feedback.mutex};
-  std::unordered_map<uint32_t, FunctionTypeFeedback>& feedback_for_function =
-      module->type_feedback.feedback_for_function;
+namespace {
+
+// Identifies the module which a profile is being loaded for. Streaming
+// compilation loads the profile before the code section was received, so only
+// the hash of the module prefix is known then.
+struct ProfileKey {
+  std::optional<uint64_t> wire_bytes_hash;
+  std::optional<uint32_t> wire_bytes_size;
+  uint64_t prefix_hash;
+};
+
+bool ReadAndCheckHeader(Decoder& decoder, const WasmModule* module,
+                        const ProfileKey& key) {
+  uint64_t wire_bytes_hash = decoder.consume_u64v("wire bytes hash", nullptr);
+  uint64_t prefix_hash = decoder.consume_u64v("prefix hash", nullptr);
+  uint32_t wire_bytes_size = decoder.consume_u32v("wire bytes size");
+  uint32_t num_declared_functions =
+      decoder.consume_u32v("num declared functions");
+  return decoder.ok() && prefix_hash == key.prefix_hash &&
+         num_declared_functions == module->num_declared_functions &&
+         (!key.wire_bytes_hash || wire_bytes_hash == *key.wire_bytes_hash) &&
+         (!key.wire_bytes_size || wire_bytes_size == *key.wire_bytes_size);
+}
+
+using TypeFeedbackEntries =
+    std::vector<std::pair<uint32_t, FunctionTypeFeedback>>;
+
+// Reads the type feedback, checking that all function indexes are in bounds.
+// The data is only applied to the module (see {ApplyTypeFeedback}) once the
+// whole profile was found to be valid.
+bool DeserializeTypeFeedback(Decoder& decoder, const WasmModule* module,
+                             TypeFeedbackEntries* entries) {
+  const uint32_t num_functions = module->num_imported_functions +
+                                 module->num_declared_functions;
+  auto IsValidFunctionIndex = [num_functions](int index) {
+    return index >= 0 && static_cast<uint32_t>(index) < num_functions;
+  };
+  // Every serialized element takes at least one byte; this bounds allocations
+  // based on sizes read from the file.
+  auto RemainingBytes = [&decoder]() {
+    return static_cast<uint32_t>(decoder.end() - decoder.pc());
+  };
+
   uint32_t num_entries = decoder.consume_u32v("num function entries");
-  CHECK_LE(num_entries, module->num_declared_functions);
+  if (num_entries > module->num_declared_functions) return false;
+  entries->reserve(num_entries);
   for (uint32_t missing_entries = num_entries; missing_entries > 0;
        --missing_entries) {
     FunctionTypeFeedback function_feedback;
     uint32_t function_index = decoder.consume_u32v("function index");
+    if (function_index < module->num_imported_functions ||
+        function_index >= num_functions) {
+      return false;
+    }
     // Deserialize {feedback_vector}.
     uint32_t feedback_vector_size =
         decoder.consume_u32v("feedback vector size");
+    if (!decoder.ok() || feedback_vector_size > RemainingBytes()) return false;
     function_feedback.feedback_vector =
         base::OwnedVector<CallSiteFeedback>::NewForOverwrite(
             feedback_vector_size);
@@ -124,75 +184,182 @@ void DeserializeTypeFeedback(Decoder& decoder, const WasmModule* module) {
       if (num_cases == 1) {          // monomorphic
         int called_function_index = decoder.consume_i32v("function index");
         int call_count = decoder.consume_i32v("call count");
+        if (!IsValidFunctionIndex(called_function_index)) return false;
         feedback = CallSiteFeedback{called_function_index, call_count};
       } else {  // polymorphic
+        if (num_cases < 0 || num_cases > kMaxPolymorphism) return false;
         auto* polymorphic = new CallSiteFeedback::PolymorphicCase[num_cases];
+        // Take ownership first, so the cases are freed on errors below.
+        feedback = CallSiteFeedback{polymorphic, num_cases};
         for (int i = 0; i < num_cases; ++i) {
           polymorphic[i].function_index =
               decoder.consume_i32v("function index");
           polymorphic[i].absolute_call_frequency =
               decoder.consume_i32v("call count");
+          if (!IsValidFunctionIndex(polymorphic[i].function_index)) {
+            return false;
+          }
         }
-        feedback = CallSiteFeedback{polymorphic, num_cases};
       }
     }
     // Deserialize {call_targets}.
     uint32_t num_call_targets = decoder.consume_u32v("num call targets");
+    if (!decoder.ok() || num_call_targets > RemainingBytes()) return false;
     function_feedback.call_targets =
         base::OwnedVector<uint32_t>::NewForOverwrite(num_call_targets);
     for (uint32_t& call_target : function_feedback.call_targets) {
       call_target = decoder.consume_u32v("call target");
+      if (call_target != FunctionTypeFeedback::kCallRef &&
+          call_target != FunctionTypeFeedback::kCallIndirect &&
+          call_target >= num_functions) {
+        return false;
+      }
     }
+    if (!decoder.ok()) return false;
+    entries->emplace_back(function_index, std::move(function_feedback));
+  }
+  return true;
+}
 
-    // Finally, insert the new feedback into the map. Overwrite existing
-    // feedback, but check for consistency.
+// Inserts the deserialized feedback into the module. Existing feedback is
+// overwritten, but only if it is consistent with the profile; otherwise
+// nothing is applied.
+bool ApplyTypeFeedback(const WasmModule* module, TypeFeedbackEntries entries) {
+  base::MutexGuard mutex_guard{&module->type_feedback.mutex};
+  std::unordered_map<uint32_t, FunctionTypeFeedback>& feedback_for_function =
+      module->type_feedback.feedback_for_function;
+  for (const auto& [function_index, function_feedback] : entries) {
+    auto feedback_it = feedback_for_function.find(function_index);
+    if (feedback_it == feedback_for_function.end()) continue;
+    const FunctionTypeFeedback& old_feedback = feedback_it->second;
+    if (!old_feedback.feedback_vector.empty() &&
+        old_feedback.feedback_vector.size() !=
+            function_feedback.feedback_vector.size()) {
+      return false;
+    }
+    if (old_feedback.call_targets.as_vector() !=
+        function_feedback.call_targets.as_vector()) {
+      return false;
+    }
+  }
+  for (auto& [function_index, function_feedback] : entries) {
     auto [feedback_it, is_new] = feedback_for_function.emplace(
         function_index, std::move(function_feedback));
     if (!is_new) {
-      FunctionTypeFeedback& old_feedback = feedback_it->second;
-      CHECK(old_feedback.feedback_vector.empty() ||
-            old_feedback.feedback_vector.size() == feedback_vector_size);
-      CHECK_EQ(old_feedback.call_targets.as_vector(),
-               function_feedback.call_targets.as_vector());
-      std::swap(old_feedback.feedback_vector,
+      std::swap(feedback_it->second.feedback_vector,
                 function_feedback.feedback_vector);
     }
   }
+  return true;
 }
 
+// Functions for which {defer_tier_up} is set are not reported as tiered up.
 std::unique_ptr<ProfileInformation> DeserializeTieringInformation(
-    Decoder& decoder, const WasmModule* module) {
+    Decoder& decoder, const WasmModule* module,
+    const std::vector<bool>& defer_tier_up) {
   std::vector<uint32_t> executed_functions;
   std::vector<uint32_t> tiered_up_functions;
   uint32_t start = module->num_imported_functions;
   uint32_t end = start + module->num_declared_functions;
   for (uint32_t func_index = start; func_index < end; ++func_index) {
     uint8_t tiering_info = decoder.consume_u8("tiering info");
-    CHECK_EQ(0, tiering_info & ~3);
+    if (tiering_info & ~(kFunctionExecutedBit | kFunctionTieredUpBit)) {
+      return {};
+    }
     bool was_executed = tiering_info & kFunctionExecutedBit;
     bool was_tiered_up = tiering_info & kFunctionTieredUpBit;
-    if (was_tiered_up) tiered_up_functions.push_back(func_index);
+    if (was_tiered_up && !defer_tier_up[func_index - start]) {
+      tiered_up_functions.push_back(func_index);
+    }
     if (was_executed) executed_functions.push_back(func_index);
   }
+  if (!decoder.ok()) return {};
 
   return std::make_unique<ProfileInformation>(std::move(executed_functions),
                                               std::move(tiered_up_functions));
 }
 
+// Returns null if the profile does not belong to the module identified by
+// {key}, or if it is malformed. Type feedback is only restored if the full wire
+// bytes were verified.
 std::unique_ptr<ProfileInformation> RestoreProfileData(
-    const WasmModule* module, base::Vector<uint8_t> profile_data) {
+    const WasmModule* module, base::Vector<uint8_t> profile_data,
+    const ProfileKey& key, const char* filename) {
   Decoder decoder{profile_data.begin(), profile_data.end()};
 
-  DeserializeTypeFeedback(decoder, module);
-  std::unique_ptr<ProfileInformation> pgo_info =
-      DeserializeTieringInformation(decoder, module);
-
-  CHECK(decoder.ok());
-  CHECK_EQ(decoder.pc(), decoder.end());
+  if (!ReadAndCheckHeader(decoder, module, key)) {
+    PrintF("Ignoring Wasm PGO data from file '%s': Different module\n",
+           filename);
+    return {};
+  }
+  TypeFeedbackEntries type_feedback;
+  std::unique_ptr<ProfileInformation> pgo_info;
+  if (DeserializeTypeFeedback(decoder, module, &type_feedback)) {
+    // If type feedback cannot be restored yet, TurboFan code for functions
+    // with feedback would be compiled without it. Leave those to the second
+    // load of the profile, which restores the feedback first.
+    std::vector<bool> defer_tier_up(module->num_declared_functions);
+    if (!key.wire_bytes_hash) {
+      for (const auto& [function_index, function_feedback] : type_feedback) {
+        defer_tier_up[function_index - module->num_imported_functions] = true;
+      }
+    }
+    pgo_info = DeserializeTieringInformation(decoder, module, defer_tier_up);
+  }
+  if (!pgo_info || decoder.pc() != decoder.end()) {
+    PrintF("Ignoring Wasm PGO data from file '%s': Invalid data\n", filename);
+    return {};
+  }
+  if (key.wire_bytes_hash &&
+      !ApplyTypeFeedback(module, std::move(type_feedback))) {
+    PrintF("Ignoring Wasm PGO data from file '%s': Inconsistent feedback\n",
+           filename);
+    return {};
+  }
 
   return pgo_info;
 }
 
+std::unique_ptr<ProfileInformation> LoadProfileFromFileNamed(
+    const WasmModule* module, const char* filename, const ProfileKey& key) {
+  FILE* file = base::OS::FOpen(filename, "rb");
+  if (!file) {
+    PrintF("No Wasm PGO data found: Cannot open file '%s'\n", filename);
+    return {};
+  }
+
+  fseek(file, 0, SEEK_END);
+  long size = ftell(file);  // NOLINT(runtime/int)
+  rewind(file);
+  if (size < 0) {
+    base::Fclose(file);
+    return {};
+  }
+
+  PrintF("Loading Wasm PGO data from file '%s' (%ld bytes)\n", filename, size);
+  base::OwnedVector<uint8_t> profile_data =
+      base::OwnedVector<uint8_t>::NewForOverwrite(static_cast<size_t>(size));
+  size_t read = fread(profile_data.begin(), 1, profile_data.size(), file);
+  base::Fclose(file);
+  if (read != profile_data.size()) {
+    PrintF("Cannot read Wasm PGO data from file '%s'\n", filename);
+    return {};
+  }
+
+  return RestoreProfileData(module, profile_data.as_vector(), key, filename);
+}
+
+void WriteProfileToFile(const char* filename,
+                        base::Vector<const uint8_t> profile_data) {
+  if (FILE* file = base::OS::FOpen(filename, "wb")) {
+    size_t written = fwrite(profile_data.begin(), 1, profile_data.size(), file);
+    CHECK_EQ(profile_data.size(), written);
+    base::Fclose(file);
+  }
+}
+
+}  // namespace
+
 void DumpProfileToFile(const WasmModule* module,
                        base::Vector<const uint8_t> wire_bytes,
                        std::atomic<uint32_t>* tiering_budget_array) {
@@ -205,18 +372,25 @@ void DumpProfileToFile(const WasmModule* module,
   SNPrintF(filename, "profile-wasm-%08x", hash);
 
   ProfileGenerator profile_generator{module, tiering_budget_array};
-  base::OwnedVector<uint8_t> profile_data = profile_generator.GetProfileData();
+  base::OwnedVector<uint8_t> profile_data =
+      profile_generator.GetProfileData(wire_bytes);
 
   PrintF(
       "Dumping Wasm PGO data to file '%s' (module size %zu, %u declared "
       "functions, %zu bytes PGO data)\n",
       filename.begin(), wire_bytes.size(), module->num_declared_functions,
       profile_data.size());
-  if (FILE* file = base::OS::FOpen(filename.begin(), "wb")) {
-    size_t written = fwrite(profile_data.begin(), 1, profile_data.size(), file);
-    CHECK_EQ(profile_data.size(), written);
-    base::Fclose(file);
-  }
+  WriteProfileToFile(filename.begin(), profile_data.as_vector());
+
+  // Streaming compilation needs the profile before the full wire bytes are
+  // available, so also store it under the hash of the module prefix (see
+  // {LoadProfileForStreaming}). The header in the profile data still contains
+  // the hash of the full wire bytes.
+  uint32_t prefix_hash =
+      static_cast<uint32_t>(NativeModuleCache::PrefixHash(wire_bytes));
+  base::EmbeddedVector<char, 32> prefix_filename;
+  SNPrintF(prefix_filename, "profile-wasm-prefix-%08x", prefix_hash);
+  WriteProfileToFile(prefix_filename.begin(), profile_data.as_vector());
 }
 
 std::unique_ptr<ProfileInformation> LoadProfileFromFile(
@@ -228,29 +402,19 @@ std::unique_ptr<ProfileInformation> LoadProfileFromFile(
   uint32_t hash = static_cast<uint32_t>(GetWireBytesHash(wire_bytes));
   base::EmbeddedVector<char, 32> filename;
   SNPrintF(filename, "profile-wasm-%08x", hash);
+  ProfileKey key{GetWireBytesHash(wire_bytes),
+                 static_cast<uint32_t>(wire_bytes.size()),
+                 NativeModuleCache::PrefixHash(wire_bytes)};
+  return LoadProfileFromFileNamed(module, filename.begin(), key);
+}
 
-  FILE* file = base::OS::FOpen(filename.begin(), "rb");
-  if (!file) {
-    PrintF("No Wasm PGO data found: Cannot open file '%s'\n", filename.begin());
-    return {};
-  }
-
-  fseek(file, 0, SEEK_END);
-  size_t size = ftell(file);
-  rewind(file);
-
-  PrintF("Loading Wasm PGO data from file '%s' (%zu bytes)\n", filename.begin(),
-         size);
-  base::OwnedVector<uint8_t> profile_data =
-      base::OwnedVector<uint8_t>::NewForOverwrite(size);
-  for (size_t read = 0; read < size;) {
-    read += fread(profile_data.begin() + read, 1, size - read, file);
-    CHECK(!ferror(file));
-  }
-
-  base::Fclose(file);
-
-  return RestoreProfileData(module, profile_data.as_vector());
+std::unique_ptr<ProfileInformation> LoadProfileForStreaming(
+    const WasmModule* module, size_t prefix_hash) {
+  base::EmbeddedVector<char, 32> filename;
+  SNPrintF(filename, "profile-wasm-prefix-%08x",
+           static_cast<uint32_t>(prefix_hash));
+  ProfileKey key{std::nullopt, std::nullopt, prefix_hash};
+  return LoadProfileFromFileNamed(module, filename.begin(), key);
 }
 
 }  // namespace v8::internal::wasm
@@ -40,12 +40,26 @@ class ProfileInformation {
   const std::vector<uint32_t> tiered_up_functions_;
 };
 
-void DumpProfileToFile(const WasmModule* module,
-                       base::Vector<const uint8_t> wire_bytes,
-                       std::atomic<uint32_t>* tiering_budget_array);
+V8_EXPORT_PRIVATE void DumpProfileToFile(
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes,
+    std::atomic<uint32_t>* tiering_budget_array);
 
-V8_WARN_UNUSED_RESULT std::unique_ptr<ProfileInformation> LoadProfileFromFile(
-    const WasmModule* module, base::Vector<const uint8_t> wire_bytes);
+// Loads profile information and restores type feedback for the given module.
+// Returns null if there is no profile for the module, or if it is malformed or
+// belongs to a different module.
+V8_EXPORT_PRIVATE V8_WARN_UNUSED_RESULT std::unique_ptr<ProfileInformation>
+LoadProfileFromFile(const WasmModule* module,
+                    base::Vector<const uint8_t> wire_bytes);
+
+// Loads profile information for a module which is being compiled via
+// streaming, before its code section was received. The module is identified by
+// the hash of its sections up to the code section header (see
+// {NativeModuleCache::PrefixHash}). Since the rest of the module is not known
+// yet, this does not restore type feedback, and functions with type feedback
+// are not reported as tiered up; call {LoadProfileFromFile} once all wire bytes
+// were received.
+V8_EXPORT_PRIVATE V8_WARN_UNUSED_RESULT std::unique_ptr<ProfileInformation>
+LoadProfileForStreaming(const WasmModule* module, size_t prefix_hash);
 
 }  // namespace v8::internal::wasm
 
@@ -6,6 +6,7 @@
 
 #include <optional>
 
+#include "src/base/hashing.h"
 #include "src/logging/counters.h"
 #include "src/wasm/decoder.h"
 #include "src/wasm/leb-helper.h"
@@ -14,6 +15,7 @@
 #include "src/wasm/wasm-limits.h"
 #include "src/wasm/wasm-objects.h"
 #include "src/wasm/wasm-result.h"
+#include "src/wasm/wasm-serialization.h"
 
 #define TRACE_STREAMING(...)                                \
   do {                                                      \
@@ -168,6 +170,10 @@ class V8_EXPORT_PRIVATE AsyncStreamingDecoder : public StreamingDecoder {
 
   void ProcessSection(SectionBuffer* buffer) {
     if (!ok()) return;
+    if (!code_section_processed_) {
+      // Mirror {NativeModuleCache::PrefixHash} for the file cache lookup.
+      prefix_hasher_.AddRange(base::Vector<const uint8_t>(buffer->payload()));
+    }
     if (!processor_->ProcessSection(
             buffer->section_code(), buffer->payload(),
             buffer->module_offset() +
@@ -189,6 +195,21 @@ class V8_EXPORT_PRIVATE AsyncStreamingDecoder : public StreamingDecoder {
     }
   }
 
+  // Called when the code section starts. If the file cache has a module with
+  // the same prefix, stop decoding and buffer the remaining bytes until
+  // {Finish}, where the full wire bytes are looked up in the cache. Otherwise
+  // keep streaming, so that a cache miss does not lose the overlap between
+  // download and compilation.
+  void CheckFileCache(uint32_t code_section_length) {
+    if (!ok()) return;
+    prefix_hasher_.Add(code_section_length);
+    if (!MayHaveNativeModuleInFileCache(prefix_hasher_.hash())) return;
+    TRACE_STREAMING("Buffering the code section for the file cache\n");
+    buffering_for_file_cache_ = true;
+  }
+
+  void ProcessBytes(base::Vector<const uint8_t> bytes);
+
   void ProcessFunctionBody(base::Vector<const uint8_t> bytes,
                            uint32_t module_offset) {
     if (!ok()) return;
@@ -221,6 +242,10 @@ class V8_EXPORT_PRIVATE AsyncStreamingDecoder : public StreamingDecoder {
   std::vector<std::shared_ptr<SectionBuffer>> section_buffers_;
   bool code_section_processed_ = false;
   uint32_t module_offset_ = 0;
+  // Set by {CheckFileCache}; all bytes from {module_offset_} on are then
+  // buffered in {full_wire_bytes_} and only decoded in {Finish}.
+  bool buffering_for_file_cache_ = false;
+  base::Hasher prefix_hasher_;
 
   // Store the full wire bytes in a vector of vectors to avoid having to grow
   // large vectors (measured up to 100ms delay in 2023-03).
@@ -252,12 +277,15 @@ void AsyncStreamingDecoder::OnBytesReceived(base::Vector<const uint8_t> bytes) {
                                    bytes.end());
   }
 
-  if (deserializing()) return;
+  if (deserializing() || buffering_for_file_cache_) return;
 
   TRACE_STREAMING("OnBytesReceived(%zu bytes)\n", bytes.size());
+  ProcessBytes(bytes);
+}
 
+void AsyncStreamingDecoder::ProcessBytes(base::Vector<const uint8_t> bytes) {
   size_t current = 0;
-  while (ok() && current < bytes.size()) {
+  while (ok() && !buffering_for_file_cache_ && current < bytes.size()) {
     size_t num_bytes =
         state_->ReadBytes(this, bytes.SubVector(current, bytes.size()));
     current += num_bytes;
@@ -318,13 +346,20 @@ void AsyncStreamingDecoder::Finish(bool can_use_compiled_module) {
 
     // Compiled module bytes are invalidated by can_use_compiled_module = false
     // or the deserialization failed. Restart decoding using |bytes_copy|.
-    // Reset {full_wire_bytes} to a single empty vector.
-    full_wire_bytes_.assign({{}});
     compiled_module_bytes_ = {};
     DCHECK(!deserializing());
-    OnBytesReceived(base::VectorOf(bytes_copy));
-    // The decoder has received all wire bytes; fall through and finish.
+    ProcessBytes(base::VectorOf(bytes_copy));
+  }
+
+  if (ok() && buffering_for_file_cache_) {
+    if (processor_->DeserializeFromFileCache(base::VectorOf(bytes_copy))) {
+      return;
+    }
+    // Cache miss; decode the bytes buffered since the code section started.
+    buffering_for_file_cache_ = false;
+    ProcessBytes(base::VectorOf(bytes_copy) + module_offset_);
   }
+  // The decoder has received all wire bytes; fall through and finish.
 
   if (ok() && !state_->is_finishing_allowed()) {
     // The byte stream ended too early, we report an error.
@@ -659,6 +694,7 @@ AsyncStreamingDecoder::DecodeSectionLength::NextWithValue(
     return std::make_unique<DecodeSectionID>(streaming->module_offset_);
   }
   if (section_id_ == SectionCode::kCodeSectionCode) {
+    streaming->CheckFileCache(static_cast<uint32_t>(value_));
     // We reached the code section. All functions of the code section are put
     // into the same SectionBuffer.
     return std::make_unique<DecodeNumberOfFunctions>(buf);
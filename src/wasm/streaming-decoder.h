@@ -61,6 +61,11 @@ class V8_EXPORT_PRIVATE StreamingProcessor {
   // Attempt to deserialize the module. Supports embedder caching.
   virtual bool Deserialize(base::Vector<const uint8_t> module_bytes,
                            base::Vector<const uint8_t> wire_bytes) = 0;
+
+  // Attempt to load the module from the --wasm-native-module-file-cache
+  // directory.
+  virtual bool DeserializeFromFileCache(
+      base::Vector<const uint8_t> wire_bytes) = 0;
 };
 
 // The StreamingDecoder takes a sequence of byte arrays, each received by a call
@@ -7553,7 +7553,17 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
         V<Word32> cond = __ Uint64LessThan(
             V<Word64>::Cast(converted_index),
             __ Word64Constant(uint64_t{wasm::kMaxMemory64Size - end_offset}));
-        __ TrapIfNot(cond, TrapId::kTrapMemOutOfBounds);
+        if (v8_flags.wasm_memory64_clamp_bounds_checks &&
+            SupportedOperations::word64_select()) {
+          // Instead of branching, redirect out-of-bounds accesses to
+          // `kMaxMemory64Size`, into the guard region reserved behind the
+          // maximum memory size (see {kMemory64ClampGuardSize}).
+          converted_index = __ WordPtrSelect(
+              cond, converted_index,
+              __ UintPtrConstant(wasm::kMaxMemory64Size - offset));
+        } else {
+          __ TrapIfNot(cond, TrapId::kTrapMemOutOfBounds);
+        }
       }
       return {converted_index, compiler::BoundsCheckResult::kTrapHandler};
     }
@@ -835,6 +835,17 @@ base::Vector<uint8_t> WasmCodeAllocator::AllocateForCodeInRegion(
   DCHECK_LT(0, size);
   auto* code_manager = GetWasmCodeManager();
   size = RoundUp<kCodeAlignment>(size);
+  if (v8_flags.wasm_reuse_freed_code_space && region == kUnrestrictedRegion) {
+    base::AddressRegion code_space = AllocateInFreedCodeSpace(size);
+    if (!code_space.is_empty()) {
+      generated_code_size_.fetch_add(code_space.size(),
+                                     std::memory_order_relaxed);
+      TRACE_HEAP("Code alloc (reused) for %p: 0x%" PRIxPTR ",+%zu\n", this,
+                 code_space.begin(), size);
+      return {reinterpret_cast<uint8_t*>(code_space.begin()),
+              code_space.size()};
+    }
+  }
   base::AddressRegion code_space =
       free_code_space_.AllocateInRegion(size, region);
   if (V8_UNLIKELY(code_space.is_empty())) {
@@ -913,6 +924,35 @@ base::Vector<uint8_t> WasmCodeAllocator::AllocateForCodeInRegion(
   return {reinterpret_cast<uint8_t*>(code_space.begin()), code_space.size()};
 }
 
+base::AddressRegion WasmCodeAllocator::AllocateInFreedCodeSpace(size_t size) {
+  // Use the first (lowest) region that fits, so that live code stays dense at
+  // the start of the code space.
+  for (base::AddressRegion region : freed_code_space_.regions()) {
+    if (region.size() < size) continue;
+    base::AddressRegion code_space =
+        freed_code_space_.AllocateInRegion(size, region);
+    DCHECK_EQ(region.begin(), code_space.begin());
+    // {FreeCode} decommitted all full pages within {region}; partial pages at
+    // its boundaries are still committed. Recommit the full pages overlapping
+    // the allocation.
+    size_t commit_page_size = CommitPageSize();
+    Address commit_start = RoundUp(region.begin(), commit_page_size);
+    Address commit_end = std::min(RoundUp(code_space.end(), commit_page_size),
+                                  RoundDown(region.end(), commit_page_size));
+    if (commit_start < commit_end) {
+      auto* code_manager = GetWasmCodeManager();
+      for (base::AddressRegion split_range : SplitRangeByReservationsIfNeeded(
+               {commit_start, commit_end - commit_start}, owned_code_space_)) {
+        code_manager->Commit(split_range);
+      }
+      committed_code_space_.fetch_add(commit_end - commit_start);
+    }
+    DCHECK(IsAligned(code_space.begin(), kCodeAlignment));
+    return code_space;
+  }
+  return {};
+}
+
 void WasmCodeAllocator::FreeCode(base::Vector<WasmCode* const> codes) {
   // Zap code area and collect freed code regions.
   DisjointAllocationPool freed_regions;
@@ -959,6 +999,14 @@ size_t WasmCodeAllocator::GetNumCodeSpaces() const {
   return owned_code_space_.size();
 }
 
+size_t WasmCodeAllocator::GetUnusedCodeSpaceSize() const {
+  size_t size = 0;
+  for (base::AddressRegion region : free_code_space_.regions()) {
+    size += region.size();
+  }
+  return size;
+}
+
 NativeModule::NativeModule(WasmEnabledFeatures enabled_features,
                            WasmDetectedFeatures detected_features,
                            CompileTimeImports compile_imports,
@@ -2803,6 +2851,11 @@ size_t NativeModule::GetNumberOfCodeSpacesForTesting() const {
   return code_allocator_.GetNumCodeSpaces();
 }
 
+size_t NativeModule::GetUnusedCodeSpaceSizeForTesting() const {
+  base::RecursiveMutexGuard guard{&allocation_mutex_};
+  return code_allocator_.GetUnusedCodeSpaceSize();
+}
+
 bool NativeModule::HasDebugInfo() const {
   base::RecursiveMutexGuard guard(&allocation_mutex_);
   return debug_info_ != nullptr;
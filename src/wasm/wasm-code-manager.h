@@ -574,9 +574,18 @@ class WasmCodeAllocator {
   // Hold the {NativeModule}'s {allocation_mutex_} when calling this method.
   size_t GetNumCodeSpaces() const;
 
+  // Returns the size of the reserved code space that was never allocated.
+  // Hold the {NativeModule}'s {allocation_mutex_} when calling this method.
+  size_t GetUnusedCodeSpaceSize() const;
+
   Counters* counters() const { return async_counters_.get(); }
 
  private:
+  // Allocate {size} bytes of code space from regions previously freed by
+  // {FreeCode}. Returns an empty region if no freed region is big enough.
+  // Hold the {NativeModule}'s {allocation_mutex_} when calling this method.
+  base::AddressRegion AllocateInFreedCodeSpace(size_t size);
+
   //////////////////////////////////////////////////////////////////////////////
   // These fields are protected by the mutex in {NativeModule}.
 
@@ -585,7 +594,8 @@ class WasmCodeAllocator {
   DisjointAllocationPool free_code_space_;
   // Code space that was allocated before but is dead now. Full
   // pages within this region are discarded. It's still a subset of
-  // {owned_code_space_}.
+  // {owned_code_space_}. With --wasm-reuse-freed-code-space, new code is
+  // allocated from here first.
   DisjointAllocationPool freed_code_space_;
   std::vector<VirtualMemory> owned_code_space_;
 
@@ -865,6 +875,9 @@ class V8_EXPORT_PRIVATE NativeModule final {
   // Retrieve the number of separately reserved code spaces for this module.
   size_t GetNumberOfCodeSpacesForTesting() const;
 
+  // Retrieve the size of the reserved code space that was never used for code.
+  size_t GetUnusedCodeSpaceSizeForTesting() const;
+
   // Check whether there is DebugInfo for this NativeModule.
   bool HasDebugInfo() const;
 
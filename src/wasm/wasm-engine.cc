@@ -38,6 +38,7 @@
 #include "src/wasm/wasm-debug.h"
 #include "src/wasm/wasm-limits.h"
 #include "src/wasm/wasm-objects-inl.h"
+#include "src/wasm/wasm-serialization.h"
 
 #if V8_ENABLE_DRUMBRAKE
 #include "src/wasm/interpreter/wasm-interpreter-inl.h"
@@ -674,6 +675,17 @@ MaybeDirectHandle<WasmModuleObject> WasmEngine::SyncCompile(
   TRACE_EVENT1("v8.wasm", "wasm.SyncCompile", "id", compilation_id);
   v8::metrics::Recorder::ContextId context_id =
       isolate->GetOrRegisterRecorderContextId(isolate->native_context());
+
+  // If a cross-process file cache is configured, try deserializing from there
+  // before compiling.
+  if (UseNativeModuleFileCache(compile_imports)) {
+    DirectHandle<WasmModuleObject> module_object;
+    if (DeserializeNativeModuleFromFileCache(isolate, bytes.as_vector(), {})
+            .ToHandle(&module_object)) {
+      return module_object;
+    }
+  }
+
   std::shared_ptr<WasmModule> module;
   WasmDetectedFeatures detected_features;
   {
@@ -842,6 +854,17 @@ void WasmEngine::AsyncCompile(
     return;
   }
 
+  // Streaming compilation (above) checks the file cache once all bytes were
+  // received; here we can check it before starting the compile job.
+  if (UseNativeModuleFileCache(compile_imports)) {
+    DirectHandle<WasmModuleObject> module_object;
+    if (DeserializeNativeModuleFromFileCache(isolate, bytes.as_vector(), {})
+            .ToHandle(&module_object)) {
+      resolver->OnCompilationSucceeded(module_object);
+      return;
+    }
+  }
+
   AsyncCompileJob* job = CreateAsyncCompileJob(
       isolate, enabled, std::move(compile_imports), std::move(bytes),
       isolate->native_context(), api_method_name_for_errors,
@@ -1540,6 +1563,61 @@ void WasmEngine::LogOutstandingCodesForIsolate(Isolate* isolate) {
   }
 }
 
+namespace {
+
+// Writes the serialized module to the --wasm-native-module-file-cache
+// directory on a worker thread.
+class StoreInFileCacheTask : public v8::Task {
+ public:
+  explicit StoreInFileCacheTask(std::weak_ptr<NativeModule> native_module)
+      : native_module_(std::move(native_module)) {}
+
+  void Run() override {
+    if (std::shared_ptr<NativeModule> native_module = native_module_.lock()) {
+      SerializeNativeModuleToFileCache(native_module.get());
+    }
+  }
+
+ private:
+  const std::weak_ptr<NativeModule> native_module_;
+};
+
+// Stores the module in the file cache once, after top-tier compilation
+// finished. With dynamic tiering this is the first point where embedders are
+// notified for code caching, otherwise the end of (eager top-tier) baseline
+// compilation.
+class StoreInFileCacheCallback : public CompilationEventCallback {
+ public:
+  explicit StoreInFileCacheCallback(std::weak_ptr<NativeModule> native_module)
+      : native_module_(std::move(native_module)) {}
+
+  void call(CompilationEvent event) override {
+    CompilationEvent final_event =
+        v8_flags.wasm_dynamic_tiering
+            ? CompilationEvent::kFinishedCompilationChunk
+            : CompilationEvent::kFinishedBaselineCompilation;
+    if (event != final_event || stored_) return;
+    stored_ = true;
+    // Callbacks are called with the compilation state's callbacks mutex held,
+    // hence do the serialization and file I/O in a separate task.
+    V8::GetCurrentPlatform()->PostTaskOnWorkerThread(
+        TaskPriority::kBestEffort,
+        std::make_unique<StoreInFileCacheTask>(native_module_));
+  }
+
+  ReleaseAfterFinalEvent release_after_final_event() override {
+    return v8_flags.wasm_dynamic_tiering ? kKeepAfterFinalEvent
+                                         : kReleaseAfterFinalEvent;
+  }
+
+ private:
+  const std::weak_ptr<NativeModule> native_module_;
+  // Only accessed with the callbacks mutex held.
+  bool stored_ = false;
+};
+
+}  // namespace
+
 std::shared_ptr<NativeModule> WasmEngine::NewNativeModule(
     Isolate* isolate, WasmEnabledFeatures enabled_features,
     WasmDetectedFeatures detected_features, CompileTimeImports compile_imports,
@@ -1562,6 +1640,10 @@ std::shared_ptr<NativeModule> WasmEngine::NewNativeModule(
       GetWasmCodeManager()->NewNativeModule(
           isolate, enabled_features, detected_features,
           std::move(compile_imports), code_size_estimate, std::move(module));
+  if (UseNativeModuleFileCache(native_module->compile_imports())) {
+    native_module->compilation_state()->AddCallback(
+        std::make_unique<StoreInFileCacheCallback>(native_module));
+  }
   base::MutexGuard lock(&mutex_);
   if (V8_UNLIKELY(v8_flags.experimental_wasm_pgo_to_file)) {
     if (!native_modules_kept_alive_for_pgo) {
@@ -372,12 +372,12 @@ std::shared_ptr<WasmImportWrapperHandle> WasmImportWrapperCache::CompileWrapper(
 
 std::shared_ptr<WasmImportWrapperHandle>
 WasmImportWrapperCache::CompileWasmJsFastCallWrapper(
-    Isolate* isolate, DirectHandle<JSReceiver> callable,
+    Isolate* isolate, DirectHandle<JSReceiver> callable, int c_function_index,
     const wasm::CanonicalSig* sig) {
   // Note: the wrapper we're about to compile is specific to this
   // instantiation, so it cannot be shared.
   WasmCompilationResult result =
-      compiler::CompileWasmJSFastCallWrapper(sig, callable);
+      compiler::CompileWasmJSFastCallWrapper(sig, callable, c_function_index);
 
   std::shared_ptr<WasmImportWrapperHandle> wrapper_handle =
       std::make_shared<WasmImportWrapperHandle>(kNullAddress,
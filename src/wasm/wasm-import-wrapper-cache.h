@@ -83,7 +83,7 @@ class WasmImportWrapperCache {
   V8_EXPORT_PRIVATE
   std::shared_ptr<WasmImportWrapperHandle> CompileWasmJsFastCallWrapper(
       Isolate* isolate, DirectHandle<JSReceiver> callable,
-      const wasm::CanonicalSig* sig);
+      int c_function_index, const wasm::CanonicalSig* sig);
 
   WasmCode* Lookup(Address pc) const;
 
@@ -111,6 +111,12 @@ inline uint64_t max_mem64_bytes() {
 constexpr size_t kMaxMemory64Size =
     size_t{kV8MaxWasmMemory64Pages} * kWasmPageSize;
 
+// With --wasm-memory64-clamp-bounds-checks, out-of-bounds memory64 accesses
+// are redirected to `kMaxMemory64Size`. This much inaccessible memory is
+// reserved behind the maximum memory64 size to make them fault. It covers the
+// largest access, and keeps the reservation size a multiple of the page size.
+constexpr size_t kMemory64ClampGuardSize = kWasmPageSize;
+
 V8_EXPORT_PRIVATE uint32_t max_table_size();
 V8_EXPORT_PRIVATE uint32_t max_table_init_entries();
 V8_EXPORT_PRIVATE size_t max_module_size();
@@ -4,12 +4,17 @@
 
 #include "src/wasm/wasm-serialization.h"
 
+#include <array>
+#include <cstdio>
+
+#include "src/base/platform/platform.h"
 #include "src/codegen/assembler-arch.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/debug/debug.h"
 #include "src/runtime/runtime.h"
 #include "src/snapshot/snapshot-data.h"
 #include "src/utils/ostreams.h"
+#include "src/utils/sha-256.h"
 #include "src/utils/version.h"
 #include "src/wasm/code-space-access.h"
 #include "src/wasm/function-compiler.h"
@@ -1162,4 +1167,215 @@ MaybeDirectHandle<WasmModuleObject> DeserializeNativeModule(
   return module_object;
 }
 
+namespace {
+
+using Sha256Digest = std::array<uint8_t, kSizeOfSha256Digest>;
+
+Sha256Digest ComputeSha256(base::Vector<const uint8_t> bytes) {
+  Sha256Digest digest;
+  SHA256_hash(bytes.begin(), bytes.size(), digest.data());
+  return digest;
+}
+
+// Files in the native module file cache start with this header, followed by
+// the full wire bytes and then the data produced by {WasmSerializer}. The file
+// name is derived from {wire_bytes_digest}; the stored wire bytes are compared
+// against the module being compiled before anything is deserialized, and
+// {data_digest} rejects truncated or otherwise corrupted files.
+// Note that the digests do not protect against a malicious writer, so the
+// cache directory must only be writable by trusted processes.
+struct FileCacheHeader {
+  uint64_t wire_bytes_size;
+  uint64_t data_size;
+  Sha256Digest wire_bytes_digest;
+  Sha256Digest data_digest;
+};
+
+// Files are named `<dir>/wasm-module-<SHA-256 of the wire bytes>`.
+std::string GetFileCachePath(const Sha256Digest& wire_bytes_digest) {
+  std::string path(v8_flags.wasm_native_module_file_cache);
+  path += base::OS::DirectorySeparator();
+  path += "wasm-module-";
+  for (uint8_t byte : wire_bytes_digest) {
+    static constexpr char kHexChars[] = "0123456789abcdef";
+    path += kHexChars[byte >> 4];
+    path += kHexChars[byte & 0xf];
+  }
+  return path;
+}
+
+// For each stored module there is an empty marker file named
+// `<dir>/wasm-prefix-<prefix hash>`, with the hash computed by
+// {NativeModuleCache::PrefixHash}. Streaming compilation checks it when it
+// reaches the code section, to decide whether to hold back the rest of the
+// module until the full wire bytes can be looked up.
+std::string GetFileCachePrefixPath(size_t prefix_hash) {
+  std::string path(v8_flags.wasm_native_module_file_cache);
+  path += base::OS::DirectorySeparator();
+  path += "wasm-prefix-";
+  uint64_t hash = static_cast<uint64_t>(prefix_hash);
+  for (int shift = 60; shift >= 0; shift -= 4) {
+    static constexpr char kHexChars[] = "0123456789abcdef";
+    path += kHexChars[(hash >> shift) & 0xf];
+  }
+  return path;
+}
+
+bool FileExists(const std::string& path) {
+  FILE* file = base::OS::FOpen(path.c_str(), "rb");
+  if (!file) return false;
+  base::Fclose(file);
+  return true;
+}
+
+}  // namespace
+
+std::string GetNativeModuleFileCachePath(
+    base::Vector<const uint8_t> wire_bytes) {
+  return GetFileCachePath(ComputeSha256(wire_bytes));
+}
+
+std::string GetNativeModuleFileCachePrefixPath(
+    base::Vector<const uint8_t> wire_bytes) {
+  return GetFileCachePrefixPath(NativeModuleCache::PrefixHash(wire_bytes));
+}
+
+bool UseNativeModuleFileCache(const CompileTimeImports& compile_imports) {
+  return V8_UNLIKELY(v8_flags.wasm_native_module_file_cache != nullptr) &&
+         !v8_flags.wasm_jitless && compile_imports.empty();
+}
+
+bool MayHaveNativeModuleInFileCache(size_t prefix_hash) {
+  if (V8_LIKELY(v8_flags.wasm_native_module_file_cache == nullptr)) {
+    return false;
+  }
+  if (v8_flags.wasm_jitless) return false;
+  return FileExists(GetFileCachePrefixPath(prefix_hash));
+}
+
+MaybeDirectHandle<WasmModuleObject> DeserializeNativeModuleFromFileCache(
+    Isolate* isolate, base::Vector<const uint8_t> wire_bytes,
+    base::Vector<const char> source_url) {
+  DCHECK_NOT_NULL(v8_flags.wasm_native_module_file_cache);
+  TRACE_EVENT0("v8.wasm", "wasm.DeserializeFromFileCache");
+  if (wire_bytes.empty()) return {};
+  Sha256Digest wire_bytes_digest = ComputeSha256(wire_bytes);
+  std::string path = GetFileCachePath(wire_bytes_digest);
+  FILE* file = base::OS::FOpen(path.c_str(), "rb");
+  if (!file) return {};
+
+  // Remove unusable entries so that they get replaced by the next compilation.
+  auto Reject = [&](const char* reason) {
+    if (file) base::Fclose(file);
+    base::OS::Remove(path.c_str());
+    if (v8_flags.trace_wasm_serialization) {
+      PrintF("[Rejecting Wasm file cache entry '%s': %s]\n", path.c_str(),
+             reason);
+    }
+    return MaybeDirectHandle<WasmModuleObject>{};
+  };
+
+  fseek(file, 0, SEEK_END);
+  long size = ftell(file);  // NOLINT(runtime/int)
+  rewind(file);
+  FileCacheHeader header;
+  if (size < static_cast<long>(sizeof(header)) ||  // NOLINT(runtime/int)
+      fread(&header, 1, sizeof(header), file) != sizeof(header)) {
+    return Reject("truncated header");
+  }
+  if (header.wire_bytes_size != wire_bytes.size() ||
+      header.wire_bytes_digest != wire_bytes_digest) {
+    return Reject("different module");
+  }
+  // Check {data_size} against the actual file size before allocating
+  // anything; the subtraction cannot overflow like an addition could.
+  uint64_t payload_size = static_cast<uint64_t>(size) - sizeof(header);
+  if (payload_size < header.wire_bytes_size ||
+      payload_size - header.wire_bytes_size != header.data_size) {
+    return Reject("unexpected file size");
+  }
+
+  base::OwnedVector<uint8_t> stored_wire_bytes =
+      base::OwnedVector<uint8_t>::NewForOverwrite(wire_bytes.size());
+  base::OwnedVector<uint8_t> data =
+      base::OwnedVector<uint8_t>::NewForOverwrite(header.data_size);
+  if (fread(stored_wire_bytes.begin(), 1, stored_wire_bytes.size(), file) !=
+          stored_wire_bytes.size() ||
+      fread(data.begin(), 1, data.size(), file) != data.size()) {
+    return Reject("read error");
+  }
+  base::Fclose(file);
+  file = nullptr;
+  // Compare the full wire bytes, so that a hash collision can never result in
+  // executing code compiled for a different module.
+  if (stored_wire_bytes.as_vector() != wire_bytes) {
+    return Reject("different wire bytes");
+  }
+  if (ComputeSha256(data.as_vector()) != header.data_digest) {
+    return Reject("corrupted data");
+  }
+
+  if (v8_flags.trace_wasm_serialization) {
+    PrintF("[Loading Wasm module from file cache '%s' (%zu bytes)]\n",
+           path.c_str(), data.size());
+  }
+  // An incompatible file (e.g. from a different V8 version or with different
+  // flags) is rejected by the version header check.
+  MaybeDirectHandle<WasmModuleObject> result = DeserializeNativeModule(
+      isolate, data.as_vector(), wire_bytes, CompileTimeImports{}, source_url);
+  if (result.is_null()) return Reject("incompatible data");
+  return result;
+}
+
+void SerializeNativeModuleToFileCache(NativeModule* native_module) {
+  DCHECK(UseNativeModuleFileCache(native_module->compile_imports()));
+  TRACE_EVENT0("v8.wasm", "wasm.SerializeToFileCache");
+  base::Vector<const uint8_t> wire_bytes = native_module->wire_bytes();
+  if (wire_bytes.empty()) return;
+
+  // The cache is written once per module; in particular, a module that was
+  // just loaded from the cache does not get written again.
+  Sha256Digest wire_bytes_digest = ComputeSha256(wire_bytes);
+  std::string path = GetFileCachePath(wire_bytes_digest);
+  if (FileExists(path)) return;
+
+  WasmSerializer serializer(native_module);
+  size_t data_size = serializer.GetSerializedNativeModuleSize();
+  base::OwnedVector<uint8_t> data =
+      base::OwnedVector<uint8_t>::NewForOverwrite(data_size);
+  if (!serializer.SerializeNativeModule(data.as_vector())) return;
+  FileCacheHeader header{wire_bytes.size(), data_size, wire_bytes_digest,
+                         ComputeSha256(data.as_vector())};
+
+  // Write to a process-specific temporary file first and rename it into place,
+  // so that concurrent readers in other processes never see a partial file.
+  std::string temp_path =
+      path + "." + std::to_string(base::OS::GetCurrentProcessId()) + ".tmp";
+  FILE* file = base::OS::FOpen(temp_path.c_str(), "wb");
+  if (!file) return;
+  bool success =
+      fwrite(&header, 1, sizeof(header), file) == sizeof(header) &&
+      fwrite(wire_bytes.begin(), 1, wire_bytes.size(), file) ==
+          wire_bytes.size() &&
+      fwrite(data.begin(), 1, data_size, file) == data_size;
+  base::Fclose(file);
+  if (!success || std::rename(temp_path.c_str(), path.c_str()) != 0) {
+    base::OS::Remove(temp_path.c_str());
+    return;
+  }
+  // Write the prefix marker last, so that it never announces a module that is
+  // not in the cache (a stale marker only costs streaming overlap).
+  std::string prefix_path =
+      GetFileCachePrefixPath(NativeModuleCache::PrefixHash(wire_bytes));
+  if (!FileExists(prefix_path)) {
+    if (FILE* marker = base::OS::FOpen(prefix_path.c_str(), "wb")) {
+      base::Fclose(marker);
+    }
+  }
+  if (v8_flags.trace_wasm_serialization) {
+    PrintF("[Stored Wasm module in file cache '%s' (%zu bytes)]\n",
+           path.c_str(), data_size);
+  }
+}
+
 }  // namespace v8::internal::wasm
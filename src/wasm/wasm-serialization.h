@@ -9,6 +9,8 @@
 #error This header should only be included if WebAssembly is enabled.
 #endif  // !V8_ENABLE_WEBASSEMBLY
 
+#include <string>
+
 #include "src/wasm/wasm-code-manager.h"
 
 namespace v8::internal::wasm {
@@ -63,6 +65,28 @@ V8_EXPORT_PRIVATE MaybeDirectHandle<WasmModuleObject> DeserializeNativeModule(
     const CompileTimeImports& compile_imports,
     base::Vector<const char> source_url);
 
+// Support for a cache of serialized modules in the directory given by
+// --wasm-native-module-file-cache, which can be shared between processes.
+// Modules are keyed by the SHA-256 hash of their wire bytes, and the full wire
+// bytes are compared before deserializing. Only modules without compile-time
+// imports are cached.
+V8_EXPORT_PRIVATE bool UseNativeModuleFileCache(
+    const CompileTimeImports& compile_imports);
+// Returns whether a module with the given {NativeModuleCache::PrefixHash} was
+// stored in the file cache. This is a cheap hint for streaming compilation;
+// the cache can still miss for the full wire bytes.
+V8_EXPORT_PRIVATE bool MayHaveNativeModuleInFileCache(size_t prefix_hash);
+V8_EXPORT_PRIVATE MaybeDirectHandle<WasmModuleObject>
+DeserializeNativeModuleFromFileCache(Isolate*,
+                                     base::Vector<const uint8_t> wire_bytes,
+                                     base::Vector<const char> source_url);
+V8_EXPORT_PRIVATE void SerializeNativeModuleToFileCache(
+    NativeModule* native_module);
+V8_EXPORT_PRIVATE std::string GetNativeModuleFileCachePath(
+    base::Vector<const uint8_t> wire_bytes);
+V8_EXPORT_PRIVATE std::string GetNativeModuleFileCachePrefixPath(
+    base::Vector<const uint8_t> wire_bytes);
+
 }  // namespace v8::internal::wasm
 
 #endif  // V8_WASM_WASM_SERIALIZATION_H_
@@ -0,0 +1,125 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/v8-context.h"
+#include "include/v8-function.h"
+#include "include/v8-json.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-persistent-handle.h"
+#include "include/v8-primitive.h"
+#include "include/v8-profiler.h"
+#include "include/v8-script.h"
+#include "src/base/logging.h"
+#include "src/base/macros.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+v8::Local<v8::String> v8_str(const char* x) {
+  return v8::String::NewFromUtf8(v8::Isolate::GetCurrent(), x).ToLocalChecked();
+}
+
+// Drops the output, only counting its size.
+class CountingOutputStream : public v8::OutputStream {
+ public:
+  void EndOfStream() override {}
+  WriteResult WriteAsciiChunk(char* data, int size) override {
+    bytes_ += size;
+    return kContinue;
+  }
+
+  size_t bytes() const { return bytes_; }
+
+ private:
+  size_t bytes_ = 0;
+};
+
+class JsonStringifyBenchmark : public v8::benchmarking::BenchmarkWithIsolate {
+ public:
+  void SetUp(::benchmark::State& state) override {
+    auto* isolate = v8_isolate();
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    context_.Reset(isolate, context);
+    context->Enter();
+
+    // An array of |state.range(0)| small objects, which the fast stringifier
+    // handles.
+    v8::Local<v8::Function> make_object =
+        v8::Script::Compile(
+            context,
+            v8_str("(function(n) {"
+                   "  return Array.from({length: n}, (_, i) => ({"
+                   "    id: i, name: 'item' + i, price: i * 0.25,"
+                   "    tags: ['a', 'b', 'c'], available: i % 2 == 0"
+                   "  }));"
+                   "})"))
+            .ToLocalChecked()
+            ->Run(context)
+            .ToLocalChecked()
+            .As<v8::Function>();
+    v8::Local<v8::Value> length =
+        v8::Integer::New(isolate, static_cast<int32_t>(state.range(0)));
+    v8::Local<v8::Value> object =
+        make_object->Call(context, context->Global(), 1, &length)
+            .ToLocalChecked();
+    object_.Reset(isolate, object);
+  }
+
+  void TearDown(::benchmark::State& state) override {
+    auto* isolate = v8_isolate();
+    v8::HandleScope handle_scope(isolate);
+    object_.Reset();
+    auto context = context_.Get(isolate);
+    context->Exit();
+    context_.Reset();
+  }
+
+ protected:
+  v8::Local<v8::Context> v8_context() { return context_.Get(v8_isolate()); }
+  v8::Local<v8::Value> object() { return object_.Get(v8_isolate()); }
+
+  v8::Global<v8::Context> context_;
+  v8::Global<v8::Value> object_;
+};
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(JsonStringifyBenchmark, Stringify)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Context> context = v8_context();
+  v8::Local<v8::Value> object = this->object();
+  size_t bytes = 0;
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_handle_scope(v8_isolate());
+    v8::Local<v8::String> result =
+        v8::JSON::Stringify(context, object).ToLocalChecked();
+    bytes += result->Length();
+    benchmark::DoNotOptimize(result);
+  }
+  st.SetBytesProcessed(bytes);
+}
+
+BENCHMARK_DEFINE_F(JsonStringifyBenchmark, StringifyToStream)
+(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Context> context = v8_context();
+  v8::Local<v8::Value> object = this->object();
+  size_t bytes = 0;
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_handle_scope(v8_isolate());
+    CountingOutputStream stream;
+    CHECK(v8::JSON::StringifyToStream(context, object, &stream).FromJust());
+    bytes += stream.bytes();
+  }
+  st.SetBytesProcessed(bytes);
+}
+
+BENCHMARK_REGISTER_F(JsonStringifyBenchmark, Stringify)->Arg(10)->Arg(10000);
+BENCHMARK_REGISTER_F(JsonStringifyBenchmark, StringifyToStream)
+    ->Arg(10)
+    ->Arg(10000);
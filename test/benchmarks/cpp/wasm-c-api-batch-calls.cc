@@ -0,0 +1,109 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "src/base/logging.h"
+#include "src/base/macros.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+#define LIBWASM_STATIC 1
+#include "third_party/wasm-api/wasm.hh"
+
+namespace {
+
+// A module exporting
+//   (func $inc (param i32) (result i32)
+//     (i32.add (local.get 0) (i32.const 1)))
+constexpr wasm::byte_t kModuleBytes[] = {
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+    // Type section: (i32) -> i32.
+    0x01, 0x06, 0x01, 0x60, 0x01, 0x7f, 0x01, 0x7f,
+    // Function section: one function of type 0.
+    0x03, 0x02, 0x01, 0x00,
+    // Export section: "inc" is function 0.
+    0x07, 0x07, 0x01, 0x03, 0x69, 0x6e, 0x63, 0x00, 0x00,
+    // Code section.
+    0x0a, 0x09, 0x01, 0x07, 0x00, 0x20, 0x00, 0x41, 0x01, 0x6a, 0x0b};
+
+// The engine initializes V8, which can only happen once per process.
+wasm::Engine* GetEngine() {
+  static wasm::own<wasm::Engine> engine = wasm::Engine::make();
+  return engine.get();
+}
+
+class WasmCApiBatchCallsBenchmark : public ::benchmark::Fixture {
+ public:
+  void SetUp(::benchmark::State& state) override {
+    store_ = wasm::Store::make(GetEngine());
+    wasm::vec<wasm::byte_t> binary =
+        wasm::vec<wasm::byte_t>::make_uninitialized(sizeof(kModuleBytes));
+    std::copy(std::begin(kModuleBytes), std::end(kModuleBytes), binary.get());
+    wasm::own<wasm::Module> module = wasm::Module::make(store_.get(), binary);
+    CHECK(module);
+    wasm::vec<wasm::Extern*> imports = wasm::vec<wasm::Extern*>::make();
+    instance_ = wasm::Instance::make(store_.get(), module.get(), imports);
+    CHECK(instance_);
+    exports_ = instance_->exports();
+    inc_ = exports_[0]->func();
+
+    size_t num_calls = static_cast<size_t>(state.range(0));
+    for (size_t i = 0; i < num_calls; ++i) {
+      args_.push_back(wasm::vec<wasm::Val>::make(
+          wasm::Val::i32(static_cast<int32_t>(i))));
+      results_.push_back(wasm::vec<wasm::Val>::make_uninitialized(1));
+    }
+  }
+
+  void TearDown(::benchmark::State& state) override {
+    args_.clear();
+    results_.clear();
+    inc_ = nullptr;
+    exports_.reset();
+    instance_.reset();
+    store_.reset();
+  }
+
+ protected:
+  wasm::own<wasm::Store> store_;
+  wasm::own<wasm::Instance> instance_;
+  wasm::ownvec<wasm::Extern> exports_ = wasm::ownvec<wasm::Extern>::make();
+  const wasm::Func* inc_ = nullptr;
+  std::vector<wasm::vec<wasm::Val>> args_;
+  std::vector<wasm::vec<wasm::Val>> results_;
+};
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(WasmCApiBatchCallsBenchmark, SingleCalls)
+(benchmark::State& st) {
+  for (auto _ : st) {
+    USE(_);
+    for (size_t i = 0; i < args_.size(); ++i) {
+      wasm::own<wasm::Trap> trap = inc_->call(args_[i], results_[i]);
+      CHECK(!trap);
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * args_.size());
+}
+
+BENCHMARK_DEFINE_F(WasmCApiBatchCallsBenchmark, BatchedCalls)
+(benchmark::State& st) {
+  for (auto _ : st) {
+    USE(_);
+    wasm::own<wasm::Trap> trap =
+        inc_->call_batch(args_.size(), args_.data(), results_.data());
+    CHECK(!trap);
+  }
+  st.SetItemsProcessed(st.iterations() * args_.size());
+}
+
+BENCHMARK_REGISTER_F(WasmCApiBatchCallsBenchmark, SingleCalls)
+    ->Arg(10)
+    ->Arg(10000);
+BENCHMARK_REGISTER_F(WasmCApiBatchCallsBenchmark, BatchedCalls)
+    ->Arg(10)
+    ->Arg(10000);
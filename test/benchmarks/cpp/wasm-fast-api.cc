@@ -0,0 +1,155 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/v8-context.h"
+#include "include/v8-fast-api-calls.h"
+#include "include/v8-internal.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-persistent-handle.h"
+#include "include/v8-template.h"
+#include "src/base/macros.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+v8::Local<v8::String> v8_str(const char* x) {
+  return v8::String::NewFromUtf8(v8::Isolate::GetCurrent(), x).ToLocalChecked();
+}
+
+// Instantiates a Wasm module that imports `f: (i32, i32) -> i32` and exports
+//   (func $run (param $n i32) (result i32) (local $acc i32)
+//     (loop
+//       (local.set $acc (call $f (local.get $acc) (local.get $n)))
+//       (br_if 0 (local.tee $n (i32.sub (local.get $n) (i32.const 1)))))
+//     (local.get $acc))
+// and returns the exported `run` function.
+const char* kInstantiateScript =
+    "function instantiate(f) {"
+    "  const bytes = new Uint8Array(["
+    "    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,"
+    // Type section: (i32, i32) -> i32, (i32) -> i32.
+    "    0x01, 0x0c, 0x02, 0x60, 0x02, 0x7f, 0x7f, 0x01, 0x7f,"
+    "    0x60, 0x01, 0x7f, 0x01, 0x7f,"
+    // Import section: "m" "f" of type 0.
+    "    0x02, 0x07, 0x01, 0x01, 0x6d, 0x01, 0x66, 0x00, 0x00,"
+    // Function section: one function of type 1.
+    "    0x03, 0x02, 0x01, 0x01,"
+    // Export section: "run" is function 1.
+    "    0x07, 0x07, 0x01, 0x03, 0x72, 0x75, 0x6e, 0x00, 0x01,"
+    // Code section.
+    "    0x0a, 0x1c, 0x01, 0x1a, 0x01, 0x01, 0x7f,"
+    "    0x03, 0x40,"
+    "      0x20, 0x01, 0x20, 0x00, 0x10, 0x00, 0x21, 0x01,"
+    "      0x20, 0x00, 0x41, 0x01, 0x6b, 0x22, 0x00,"
+    "      0x0d, 0x00,"
+    "    0x0b,"
+    "    0x20, 0x01,"
+    "    0x0b,"
+    "  ]);"
+    "  const module = new WebAssembly.Module(bytes);"
+    "  return new WebAssembly.Instance(module, {m: {f}}).exports.run;"
+    "}"
+    "globalThis.runFast = instantiate(globalThis.fastAdd);"
+    "globalThis.runRegular = instantiate(globalThis.regularAdd);"
+    "globalThis.runJS = instantiate((a, b) => (a + b) | 0);";
+
+class WasmFastApiBenchmark : public v8::benchmarking::BenchmarkWithIsolate {
+ public:
+  static int32_t FastAdd(v8::Local<v8::Value> receiver, int32_t a, int32_t b,
+                         v8::FastApiCallbackOptions& options) {
+    return static_cast<int32_t>(static_cast<uint32_t>(a) +
+                                static_cast<uint32_t>(b));
+  }
+
+  static void RegularAdd(const v8::FunctionCallbackInfo<v8::Value>& info) {
+    v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
+    int32_t a = info[0]->Int32Value(context).FromJust();
+    int32_t b = info[1]->Int32Value(context).FromJust();
+    info.GetReturnValue().Set(static_cast<int32_t>(static_cast<uint32_t>(a) +
+                                                   static_cast<uint32_t>(b)));
+  }
+
+  void SetUp(::benchmark::State& state) override {
+    auto* isolate = v8_isolate();
+    v8::HandleScope handle_scope(isolate);
+
+    auto proxy_template_function = v8::FunctionTemplate::New(isolate);
+    auto object_template = proxy_template_function->InstanceTemplate();
+    {
+      v8::CFunction fast_callback =
+          v8::CFunction::Make(WasmFastApiBenchmark::FastAdd);
+
+      object_template->Set(
+          isolate, "fastAdd",
+          v8::FunctionTemplate::New(
+              isolate, WasmFastApiBenchmark::RegularAdd, v8::Local<v8::Value>(),
+              v8::Local<v8::Signature>(), 2, v8::ConstructorBehavior::kThrow,
+              v8::SideEffectType::kHasSideEffect, &fast_callback));
+    }
+    {
+      object_template->Set(
+          isolate, "regularAdd",
+          v8::FunctionTemplate::New(isolate, WasmFastApiBenchmark::RegularAdd));
+    }
+
+    v8::Local<v8::Context> context =
+        v8::Context::New(isolate, nullptr, object_template);
+
+    context_.Reset(isolate, context);
+    context->Enter();
+
+    CompileBenchmarkScript(kInstantiateScript)
+        ->Run(context)
+        .ToLocalChecked();
+  }
+
+  void TearDown(::benchmark::State& state) override {
+    auto* isolate = v8_isolate();
+    v8::HandleScope handle_scope(isolate);
+    auto context = context_.Get(isolate);
+    context->Exit();
+    context_.Reset();
+  }
+
+  v8::Local<v8::Script> CompileBenchmarkScript(const char* source) {
+    v8::EscapableHandleScope handle_scope(v8_isolate());
+    v8::Local<v8::Context> context = v8_context();
+    v8::Local<v8::String> v8_source = v8_str(source);
+    v8::Local<v8::Script> script =
+        v8::Script::Compile(context, v8_source).ToLocalChecked();
+    return handle_scope.Escape(script);
+  }
+
+  void RunBenchmarkScript(benchmark::State& st, const char* source) {
+    v8::HandleScope handle_scope(v8_isolate());
+    v8::Local<v8::Context> context = v8_context();
+    v8::Local<v8::Script> script = CompileBenchmarkScript(source);
+    v8::HandleScope benchmark_handle_scope(v8_isolate());
+    for (auto _ : st) {
+      USE(_);
+      v8::Local<v8::Value> result = script->Run(context).ToLocalChecked();
+      benchmark::DoNotOptimize(result);
+    }
+  }
+
+ protected:
+  v8::Local<v8::Context> v8_context() { return context_.Get(v8_isolate()); }
+
+  v8::Global<v8::Context> context_;
+};
+
+}  // namespace
+
+BENCHMARK_F(WasmFastApiBenchmark, FastCallFromWasm)(benchmark::State& st) {
+  RunBenchmarkScript(st, "globalThis.runFast(1_000_000);");
+}
+
+BENCHMARK_F(WasmFastApiBenchmark, RegularCallFromWasm)(benchmark::State& st) {
+  RunBenchmarkScript(st, "globalThis.runRegular(1_000_000);");
+}
+
+BENCHMARK_F(WasmFastApiBenchmark, JSCallFromWasm)(benchmark::State& st) {
+  RunBenchmarkScript(st, "globalThis.runJS(1_000_000);");
+}
@@ -52,6 +52,7 @@
 #include "include/v8-json.h"
 #include "include/v8-locker.h"
 #include "include/v8-primitive-object.h"
+#include "include/v8-profiler.h"
 #include "include/v8-regexp.h"
 #include "include/v8-util.h"
 #include "src/api/api-inl.h"
@@ -21500,6 +21501,101 @@ THREADED_TEST(JSONParseArray) {
                      i::PACKED_ELEMENTS);
 }
 
+namespace {
+// Parses |input| with the value of |hint_source| as the shape hint and checks
+// that the result is the same as without it. The hint and the result are
+// stored in the globals "hint" and "result".
+void TestJSONParseWithShapeHint(LocalContext* context, const char* input,
+                                const char* hint_source) {
+  Local<Object> hint = CompileRun(hint_source).As<Object>();
+  Local<Value> result =
+      v8::JSON::ParseWithShapeHint(context->local(), v8_str(input), hint)
+          .ToLocalChecked();
+  Local<Value> expected =
+      v8::JSON::Parse(context->local(), v8_str(input)).ToLocalChecked();
+  Local<Object> global = (*context)->Global();
+  global->Set(context->local(), v8_str("hint"), hint).FromJust();
+  global->Set(context->local(), v8_str("result"), result).FromJust();
+  global->Set(context->local(), v8_str("expected"), expected).FromJust();
+  ExpectTrue("JSON.stringify(result) === JSON.stringify(expected)");
+}
+
+i::Tagged<i::Map> MapOf(const char* source) {
+  Local<Value> value = CompileRun(source);
+  return i::Cast<i::JSObject>(*v8::Utils::OpenDirectHandle(*value))->map();
+}
+}  // namespace
+
+THREADED_TEST(JSONParseWithShapeHint) {
+  LocalContext context;
+  HandleScope scope(context.isolate());
+
+  // Results of earlier parses describe the objects of later ones.
+  TestJSONParseWithShapeHint(
+      &context,
+      "{\"id\":2,\"user\":{\"name\":\"b\",\"score\":3.5},"
+      "\"items\":[{\"x\":3,\"y\":\"c\"},{\"x\":4,\"y\":\"d\"}]}",
+      "JSON.parse('{\"id\":1,\"user\":{\"name\":\"a\",\"score\":2.5},"
+      "\"items\":[{\"x\":1,\"y\":\"a\"}]}')");
+  CHECK_EQ(MapOf("hint"), MapOf("result"));
+  CHECK_EQ(MapOf("hint.user"), MapOf("result.user"));
+  CHECK_EQ(MapOf("hint.items[0]"), MapOf("result.items[0]"));
+  CHECK_EQ(MapOf("hint.items[0]"), MapOf("result.items[1]"));
+
+  // So do object literals.
+  TestJSONParseWithShapeHint(&context,
+                             "[{\"a\":1,\"b\":[{\"c\":0.5}]},{\"a\":2}]",
+                             "[{a: 0, b: [{c: 1.5}]}]");
+  ExpectTrue("result[1].a === 2 && result[0].b[0].c === 0.5");
+  CHECK_EQ(MapOf("hint[0]"), MapOf("result[0]"));
+  CHECK_EQ(MapOf("hint[0].b[0]"), MapOf("result[0].b[0]"));
+
+  // Cyclic hints and hints with many objects are only walked partially.
+  TestJSONParseWithShapeHint(
+      &context, "{\"a\":2,\"self\":{\"a\":3,\"self\":null,\"other\":1}}",
+      "(() => {"
+      "  let o = {a: 1, self: null, other: null};"
+      "  o.self = o;"
+      "  o.other = o;"
+      "  return o;"
+      "})()");
+  TestJSONParseWithShapeHint(&context, "[{\"x\":1}]",
+                             "(() => {"
+                             "  let n = 0;"
+                             "  function Tree(depth) {"
+                             "    if (depth == 0) return {x: 1};"
+                             "    let o = {};"
+                             "    o['k' + n++] = Tree(depth - 1);"
+                             "    o['k' + n++] = Tree(depth - 1);"
+                             "    return o;"
+                             "  }"
+                             "  return Tree(10);"
+                             "})()");
+
+  // Inputs that don't match the hint are parsed as usual.
+  TestJSONParseWithShapeHint(&context,
+                             "{\"a\":\"x\",\"c\":{\"d\":null},\"b\":[]}",
+                             "({a: 1, b: 2, c: {d: 1.5, e: 0}})");
+  TestJSONParseWithShapeHint(&context, "[1, \"a\", {}, [{}]]", "[{a: 1}]");
+
+  // Hints with layouts that the parser wouldn't create are ignored.
+  TestJSONParseWithShapeHint(&context, "{\"a\":2}",
+                             "new (class { constructor() { this.a = 1; } })");
+  ExpectTrue("Object.getPrototypeOf(result) === Object.prototype");
+  TestJSONParseWithShapeHint(&context, "{\"a\":2,\"b\":3}",
+                             "Object.freeze({a: 1, b: 2})");
+  TestJSONParseWithShapeHint(
+      &context, "{\"a\":2,\"b\":3}",
+      "Object.defineProperty({a: 1}, 'b', {value: 2, enumerable: false})");
+  TestJSONParseWithShapeHint(&context, "{\"a\":2,\"b\":3}",
+                             "({a: 1, get b() { return 2; }})");
+  ExpectTrue("result.a = 4, result.b = 5, result.c = 6,"
+             "JSON.stringify(result) === '{\"a\":4,\"b\":5,\"c\":6}'");
+  TestJSONParseWithShapeHint(
+      &context, "{\"a\":2}",
+      "(() => { let o = {a: 1, b: 1}; delete o.a; o.a = 2; return o; })()");
+}
+
 THREADED_TEST(JSONStringifyObject) {
   LocalContext context;
   HandleScope scope(context.isolate());
@@ -21528,6 +21624,120 @@ THREADED_TEST(JSONStringifyObjectWithGap) {
   ExpectString("JSON.stringify(obj, null,  '*')", *utf8);
 }
 
+namespace {
+
+class JsonTestOutputStream : public v8::OutputStream {
+ public:
+  explicit JsonTestOutputStream(int chunk_size, int abort_after_chunks = -1)
+      : chunk_size_(chunk_size), abort_after_chunks_(abort_after_chunks) {}
+
+  void EndOfStream() override { ++end_of_stream_count_; }
+  int GetChunkSize() override { return chunk_size_; }
+  WriteResult WriteAsciiChunk(char* data, int size) override {
+    CHECK_LT(0, size);
+    CHECK_LE(size, chunk_size_);
+    output_.append(data, size);
+    return ++chunk_count_ == abort_after_chunks_ ? kAbort : kContinue;
+  }
+
+  const std::string& output() const { return output_; }
+  int chunk_count() const { return chunk_count_; }
+  int end_of_stream_count() const { return end_of_stream_count_; }
+
+ private:
+  const int chunk_size_;
+  const int abort_after_chunks_;
+  std::string output_;
+  int chunk_count_ = 0;
+  int end_of_stream_count_ = 0;
+};
+
+void CheckJSONStringifyToStream(LocalContext* context, const char* source,
+                                Local<String> gap = Local<String>()) {
+  Local<Value> value = CompileRun(source);
+  Local<String> expected =
+      v8::JSON::Stringify(context->local(), value, gap).ToLocalChecked();
+  v8::String::Utf8Value utf8(context->isolate(), expected);
+  // Chunks may also end in the middle of a UTF-8 sequence.
+  for (int chunk_size : {1, 7, 1024}) {
+    JsonTestOutputStream stream(chunk_size);
+    CHECK(v8::JSON::StringifyToStream(context->local(), value, &stream, gap)
+              .FromJust());
+    CHECK_EQ(1, stream.end_of_stream_count());
+    CHECK_EQ(std::string(*utf8, utf8.length()), stream.output());
+  }
+}
+
+}  // namespace
+
+THREADED_TEST(JSONStringifyToStream) {
+  LocalContext context;
+  HandleScope scope(context.isolate());
+  CheckJSONStringifyToStream(&context,
+                             "({a: 1, b: [1.5, -0, 1e21], c: 'x\"'})");
+  // Strings that need more than one byte per character, including
+  // surrogate pairs.
+  CheckJSONStringifyToStream(&context, "['\\u00e9\\u4e2d'.repeat(1000)]");
+  CheckJSONStringifyToStream(&context,
+                             "({['\\u{1F600}'.repeat(10)]: '\\u{1F600}x'})");
+  CheckJSONStringifyToStream(&context,
+                             "['a'.repeat(5000), '\\u{1F600}'.repeat(5000)]");
+  // Output that is larger than the buffers of the stringifiers.
+  CheckJSONStringifyToStream(
+      &context, "Array.from({length: 20000}, (_, i) => i + 0.5)");
+  CheckJSONStringifyToStream(&context,
+                             "let o = {};"
+                             "for (let i = 0; i < 2000; i++) o['k' + i] = [i];"
+                             "delete o.k0;"
+                             "o");
+  // Falling back to the slow path after output has been written.
+  CheckJSONStringifyToStream(
+      &context,
+      "[...Array(5000).keys(), {toJSON() { return '\\u1234'; }}, 'x']");
+  CheckJSONStringifyToStream(
+      &context,
+      "let a = {toJSON() { return 1; }};"
+      "for (let i = 0; i < 12; i++) a = ['x'.repeat(100), a];"
+      "a");
+  CheckJSONStringifyToStream(&context, "({a: [1, {b: 2}], c: 'd'})",
+                             v8_str("  "));
+}
+
+THREADED_TEST(JSONStringifyToStreamUndefined) {
+  LocalContext context;
+  HandleScope scope(context.isolate());
+  JsonTestOutputStream stream(16);
+  Local<Value> value = v8::Undefined(context.isolate());
+  CHECK(v8::JSON::StringifyToStream(context.local(), value, &stream)
+            .FromJust());
+  CHECK_EQ(0, stream.chunk_count());
+  CHECK_EQ(1, stream.end_of_stream_count());
+}
+
+THREADED_TEST(JSONStringifyToStreamAbort) {
+  LocalContext context;
+  HandleScope scope(context.isolate());
+  Local<Value> value = CompileRun("Array.from({length: 1000}, (_, i) => i)");
+  JsonTestOutputStream stream(16, 2);
+  CHECK(!v8::JSON::StringifyToStream(context.local(), value, &stream)
+             .FromJust());
+  CHECK_EQ(2, stream.chunk_count());
+  CHECK_EQ(0, stream.end_of_stream_count());
+  CHECK_EQ(std::string("[0,1,2,3,4,5,6,7,8,9,10,11,12,13"), stream.output());
+}
+
+THREADED_TEST(JSONStringifyToStreamException) {
+  LocalContext context;
+  HandleScope scope(context.isolate());
+  Local<Value> value = CompileRun("[1, {toJSON() { throw 42; }}]");
+  JsonTestOutputStream stream(16);
+  v8::TryCatch try_catch(context.isolate());
+  CHECK(v8::JSON::StringifyToStream(context.local(), value, &stream)
+            .IsNothing());
+  CHECK(try_catch.HasCaught());
+  CHECK_EQ(0, stream.end_of_stream_count());
+}
+
 #if V8_OS_POSIX
 class ThreadInterruptTest {
  public:
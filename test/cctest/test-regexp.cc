@@ -6,6 +6,8 @@
 #include "include/v8-regexp.h"
 #include "src/api/api-inl.h"
 #include "src/execution/frames-inl.h"
+#include "src/init/isolate-group.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-utils.h"
 
@@ -346,3 +348,64 @@ TEST(InterruptAndTransitionSubjectFromTwoByteToOneByte) {
       Cast<i::IrRegExpData>(regexp->data(i_isolate));
   CHECK(data->has_latin1_bytecode());
 }
+
+namespace {
+
+// Runs `source` in a new context of `isolate` and returns whether the result
+// is true.
+bool RunInNewContext(Isolate* isolate, const char* source) {
+  Isolate::Scope isolate_scope(isolate);
+  HandleScope handle_scope(isolate);
+  Local<Context> context = Context::New(isolate);
+  Context::Scope context_scope(context);
+  return CompileRun(source)->BooleanValue(isolate);
+}
+
+}  // namespace
+
+// The isolates of an IsolateGroup share irregexp bytecode: the second isolate
+// installs the bytecode compiled by the first one instead of compiling the
+// regexp itself.
+UNINITIALIZED_TEST(SharedBytecodeCacheAcrossIsolates) {
+  i::v8_flags.regexp_shared_bytecode_cache = true;
+  i::v8_flags.regexp_tier_up = true;
+  Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  IsolateGroup group = IsolateGroup::GetDefault();
+  Isolate* isolate1 = Isolate::New(group, create_params);
+  Isolate* isolate2 = Isolate::New(group, create_params);
+  i::Isolate* i_isolate1 = reinterpret_cast<i::Isolate*>(isolate1);
+  i::Isolate* i_isolate2 = reinterpret_cast<i::Isolate*>(isolate2);
+  i::RegExpBytecodeCache* cache =
+      i_isolate1->isolate_group()->regexp_bytecode_cache();
+  CHECK_EQ(cache, i_isolate2->isolate_group()->regexp_bytecode_cache());
+  cache->Clear();
+
+  // The first isolate compiles the regexp and caches its bytecode.
+  CHECK(RunInNewContext(isolate1, "/x(a|b)+y/.test('xaby')"));
+  size_t cache_size = cache->size_for_testing();
+  CHECK_LT(0, cache_size);
+
+  // The second isolate hits the cache and does not add another entry.
+  CHECK(RunInNewContext(isolate2, "/x(a|b)+y/.test('xaby')"));
+  CHECK_EQ(cache_size, cache->size_for_testing());
+
+  // Compilation is skipped on a hit: with the cached bytecode stored for a
+  // different pattern, that pattern matches like the cached one.
+  {
+    Isolate::Scope isolate_scope(isolate2);
+    i::HandleScope handle_scope(i_isolate2);
+    i::Factory* factory = i_isolate2->factory();
+    std::shared_ptr<const i::RegExpBytecodeCache::Entry> entry =
+        cache->Lookup(*factory->NewStringFromAsciiChecked("x(a|b)+y"), {},
+                      true, i::JSRegExp::kNoBacktrackLimit);
+    CHECK_NOT_NULL(entry);
+    cache->Insert(*factory->NewStringFromAsciiChecked("x(c|d)+y"), {}, true,
+                  i::JSRegExp::kNoBacktrackLimit, entry);
+  }
+  CHECK(RunInNewContext(isolate2, "/x(c|d)+y/.test('xaby')"));
+
+  cache->Clear();
+  isolate1->Dispose();
+  isolate2->Dispose();
+}
@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <cstdio>
+
 #include "include/libplatform/libplatform.h"
 #include "src/api/api-inl.h"
 #include "src/base/vector.h"
@@ -11,6 +13,7 @@
 #include "src/objects/objects-inl.h"
 #include "src/wasm/module-compiler.h"
 #include "src/wasm/module-decoder.h"
+#include "src/wasm/pgo.h"
 #include "src/wasm/streaming-decoder.h"
 #include "src/wasm/wasm-engine.h"
 #include "src/wasm/wasm-module-builder.h"
@@ -1396,6 +1399,163 @@ STREAM_TEST(TestDeserializationFails) {
   CHECK(tester.IsPromiseFulfilled());
 }
 
+namespace {
+
+// Create a module with three functions, where the first one calls the second
+// one. {constant} only changes the code of the last function, so modules for
+// different constants have the same prefix hash (see
+// {NativeModuleCache::PrefixHash}).
+ZoneBuffer GetModuleBytesForPgo(Zone* zone, uint8_t constant) {
+  ZoneBuffer buffer(zone);
+  TestSignatures sigs;
+  WasmModuleBuilder builder(zone);
+  WasmFunctionBuilder* f0 = builder.AddFunction(sigs.i_i());
+  WasmFunctionBuilder* f1 = builder.AddFunction(sigs.i_i());
+  WasmFunctionBuilder* f2 = builder.AddFunction(sigs.i_i());
+  f0->EmitCode({WASM_CALL_FUNCTION(1, WASM_LOCAL_GET(0)), kExprEnd});
+  f1->EmitCode({WASM_LOCAL_GET(0), kExprEnd});
+  f2->EmitCode({WASM_I32_ADD(WASM_LOCAL_GET(0), WASM_I32V_1(constant)),
+                kExprEnd});
+  builder.AddExport(base::CStrVector("main"), f0);
+  builder.AddExport(base::CStrVector("other"), f2);
+  builder.WriteTo(&buffer);
+  return buffer;
+}
+
+std::string ProfileFileName(base::Vector<const uint8_t> wire_bytes,
+                            bool for_streaming) {
+  base::EmbeddedVector<char, 32> filename;
+  if (for_streaming) {
+    SNPrintF(filename, "profile-wasm-prefix-%08x",
+             static_cast<uint32_t>(NativeModuleCache::PrefixHash(wire_bytes)));
+  } else {
+    SNPrintF(filename, "profile-wasm-%08x",
+             static_cast<uint32_t>(GetWireBytesHash(wire_bytes)));
+  }
+  return filename.begin();
+}
+
+// Writes a profile in which {tiered_up_function} was tiered up and the call in
+// function 0 always called function 1.
+void WriteProfileForPgo(base::Vector<const uint8_t> wire_bytes,
+                        uint32_t tiered_up_function = 1) {
+  WasmDetectedFeatures detected_features;
+  ModuleResult result =
+      DecodeWasmModule(WasmEnabledFeatures::All(), wire_bytes, false,
+                       kWasmOrigin, &detected_features);
+  CHECK(result.ok());
+  std::shared_ptr<WasmModule> module = std::move(result).value();
+  {
+    base::MutexGuard mutex_guard{&module->type_feedback.mutex};
+    FunctionTypeFeedback& caller_feedback =
+        module->type_feedback.feedback_for_function[0];
+    caller_feedback.feedback_vector =
+        base::OwnedVector<CallSiteFeedback>::NewForOverwrite(1);
+    caller_feedback.feedback_vector[0] = CallSiteFeedback{1, 100};
+    caller_feedback.call_targets = base::OwnedCopyOf({uint32_t{1}});
+    module->type_feedback.feedback_for_function[tiered_up_function]
+        .tierup_priority = 1;
+  }
+  std::atomic<uint32_t> tiering_budgets[3];
+  for (auto& budget : tiering_budgets) budget = v8_flags.wasm_tiering_budget;
+  tiering_budgets[0] = 0;  // Function 0 was executed.
+  DumpProfileToFile(module.get(), wire_bytes, tiering_budgets);
+}
+
+bool HasTypeFeedbackForCaller(NativeModule* native_module) {
+  const WasmModule* module = native_module->module();
+  base::MutexGuard mutex_guard{&module->type_feedback.mutex};
+  auto it = module->type_feedback.feedback_for_function.find(0);
+  return it != module->type_feedback.feedback_for_function.end() &&
+         !it->second.feedback_vector.empty();
+}
+
+}  // namespace
+
+// Test that streaming compilation applies a PGO profile which matches the
+// module: hot functions get compiled with TurboFan right away, and type
+// feedback is restored.
+STREAM_TEST(TestPgoFromFile) {
+  FlagScope<bool> pgo_from_file(&v8_flags.experimental_wasm_pgo_from_file,
+                                true);
+  StreamTester tester(isolate);
+  ZoneBuffer wire_bytes = GetModuleBytesForPgo(tester.zone(), 1);
+  WriteProfileForPgo(base::VectorOf(wire_bytes));
+
+  tester.OnBytesReceived(wire_bytes.begin(), wire_bytes.size());
+  tester.FinishStream();
+  tester.RunCompilerTasks();
+  CHECK(tester.IsPromiseFulfilled());
+
+  NativeModule* native_module = tester.native_module();
+  CHECK(HasTypeFeedbackForCaller(native_module));
+  {
+    WasmCodeRefScope code_ref_scope;
+    WasmCode* code = native_module->GetCode(1);
+    CHECK_NOT_NULL(code);
+    CHECK_EQ(ExecutionTier::kTurbofan, code->tier());
+  }
+
+  base::OS::Remove(ProfileFileName(base::VectorOf(wire_bytes), true).c_str());
+  base::OS::Remove(ProfileFileName(base::VectorOf(wire_bytes), false).c_str());
+}
+
+// Test that a function which was tiered up in the profiling run and has call
+// feedback only gets compiled with TurboFan once its feedback was restored, so
+// that the called function gets inlined.
+STREAM_TEST(TestPgoFromFileTierUpWithFeedback) {
+  FlagScope<bool> pgo_from_file(&v8_flags.experimental_wasm_pgo_from_file,
+                                true);
+  StreamTester tester(isolate);
+  ZoneBuffer wire_bytes = GetModuleBytesForPgo(tester.zone(), 1);
+  WriteProfileForPgo(base::VectorOf(wire_bytes), 0);
+
+  tester.OnBytesReceived(wire_bytes.begin(), wire_bytes.size());
+  tester.FinishStream();
+  tester.RunCompilerTasks();
+  CHECK(tester.IsPromiseFulfilled());
+
+  NativeModule* native_module = tester.native_module();
+  CHECK(HasTypeFeedbackForCaller(native_module));
+  {
+    WasmCodeRefScope code_ref_scope;
+    WasmCode* code = native_module->GetCode(0);
+    CHECK_NOT_NULL(code);
+    CHECK_EQ(ExecutionTier::kTurbofan, code->tier());
+    CHECK(!code->inlining_positions().empty());
+  }
+
+  base::OS::Remove(ProfileFileName(base::VectorOf(wire_bytes), true).c_str());
+  base::OS::Remove(ProfileFileName(base::VectorOf(wire_bytes), false).c_str());
+}
+
+// Test that a stale profile for a module with the same prefix, but different
+// code, does not restore type feedback. The profile is also stored under the
+// name of the streamed module, so only the hash in the file tells it apart.
+STREAM_TEST(TestPgoFromFileStaleProfile) {
+  FlagScope<bool> pgo_from_file(&v8_flags.experimental_wasm_pgo_from_file,
+                                true);
+  StreamTester tester(isolate);
+  ZoneBuffer old_wire_bytes = GetModuleBytesForPgo(tester.zone(), 1);
+  ZoneBuffer wire_bytes = GetModuleBytesForPgo(tester.zone(), 2);
+  CHECK_EQ(NativeModuleCache::PrefixHash(base::VectorOf(old_wire_bytes)),
+           NativeModuleCache::PrefixHash(base::VectorOf(wire_bytes)));
+  WriteProfileForPgo(base::VectorOf(old_wire_bytes));
+  std::string old_filename =
+      ProfileFileName(base::VectorOf(old_wire_bytes), false);
+  std::string filename = ProfileFileName(base::VectorOf(wire_bytes), false);
+  CHECK_EQ(0, std::rename(old_filename.c_str(), filename.c_str()));
+
+  tester.OnBytesReceived(wire_bytes.begin(), wire_bytes.size());
+  tester.FinishStream();
+  tester.RunCompilerTasks();
+  CHECK(tester.IsPromiseFulfilled());
+  CHECK(!HasTypeFeedbackForCaller(tester.native_module()));
+
+  base::OS::Remove(ProfileFileName(base::VectorOf(wire_bytes), true).c_str());
+  base::OS::Remove(filename.c_str());
+}
+
 // Test that a non-empty function section with a missing code section fails.
 STREAM_TEST(TestFunctionSectionWithoutCodeSection) {
   StreamTester tester(isolate);
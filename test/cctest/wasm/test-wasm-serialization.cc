@@ -7,6 +7,7 @@
 
 #include "include/v8-wasm.h"
 #include "src/api/api-inl.h"
+#include "src/base/platform/platform.h"
 #include "src/objects/objects-inl.h"
 #include "src/snapshot/code-serializer.h"
 #include "src/utils/version.h"
@@ -333,6 +334,113 @@ UNINITIALIZED_TEST(CompiledWasmModulesTransfer) {
   from_isolate->Dispose();
 }
 
+namespace {
+
+std::vector<uint8_t> ReadFileContents(const std::string& path) {
+  std::vector<uint8_t> contents;
+  FILE* file = base::OS::FOpen(path.c_str(), "rb");
+  CHECK_NOT_NULL(file);
+  uint8_t buffer[1024];
+  while (size_t read = fread(buffer, 1, sizeof(buffer), file)) {
+    contents.insert(contents.end(), buffer, buffer + read);
+  }
+  base::Fclose(file);
+  return contents;
+}
+
+void WriteFileContents(const std::string& path,
+                       base::Vector<const uint8_t> contents) {
+  FILE* file = base::OS::FOpen(path.c_str(), "wb");
+  CHECK_NOT_NULL(file);
+  CHECK_EQ(contents.size(), fwrite(contents.begin(), 1, contents.size(), file));
+  base::Fclose(file);
+}
+
+bool FileExists(const std::string& path) {
+  FILE* file = base::OS::FOpen(path.c_str(), "rb");
+  if (!file) return false;
+  base::Fclose(file);
+  return true;
+}
+
+}  // namespace
+
+TEST(NativeModuleFileCache) {
+  WasmSerializationTest test;
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+  // Get a tiered-up module before enabling the file cache, so that no
+  // background task writes the cache concurrently to this test.
+  DirectHandle<WasmModuleObject> module_object;
+  CHECK(test.Deserialize().ToHandle(&module_object));
+
+  FlagScope<const char*> file_cache(&v8_flags.wasm_native_module_file_cache,
+                                    ".");
+  base::Vector<const uint8_t> wire_bytes =
+      base::VectorOf(test.wire_bytes().data(), test.wire_bytes().size());
+  std::string path = GetNativeModuleFileCachePath(wire_bytes);
+  base::OS::Remove(path.c_str());
+  size_t prefix_hash = NativeModuleCache::PrefixHash(wire_bytes);
+
+  // Miss.
+  CHECK(DeserializeNativeModuleFromFileCache(isolate, wire_bytes, {})
+            .is_null());
+
+  // Store and hit. Storing also announces the module prefix to streaming
+  // compilation.
+  SerializeNativeModuleToFileCache(module_object->native_module());
+  CHECK(FileExists(path));
+  CHECK(MayHaveNativeModuleInFileCache(prefix_hash));
+  DirectHandle<WasmModuleObject> cached_module_object;
+  CHECK(DeserializeNativeModuleFromFileCache(isolate, wire_bytes, {})
+            .ToHandle(&cached_module_object));
+  CHECK(wire_bytes == cached_module_object->native_module()->wire_bytes());
+  std::vector<uint8_t> contents = ReadFileContents(path);
+
+  // A valid file stored under the name of different wire bytes is rejected
+  // (and removed).
+  std::vector<uint8_t> other_wire_bytes(wire_bytes.begin(), wire_bytes.end());
+  other_wire_bytes.back() ^= 1;
+  std::string other_path =
+      GetNativeModuleFileCachePath(base::VectorOf(other_wire_bytes));
+  CHECK_NE(path, other_path);
+  WriteFileContents(other_path, base::VectorOf(contents));
+  CHECK(DeserializeNativeModuleFromFileCache(
+            isolate, base::VectorOf(other_wire_bytes), {})
+            .is_null());
+  CHECK(!FileExists(other_path));
+
+  // Corrupted serialized data is rejected (and removed).
+  std::vector<uint8_t> corrupted = contents;
+  corrupted.back() ^= 1;
+  WriteFileContents(path, base::VectorOf(corrupted));
+  CHECK(DeserializeNativeModuleFromFileCache(isolate, wire_bytes, {})
+            .is_null());
+  CHECK(!FileExists(path));
+
+  // A truncated file is rejected (and removed).
+  WriteFileContents(path, base::VectorOf(contents).SubVector(
+                              0, contents.size() / 2));
+  CHECK(DeserializeNativeModuleFromFileCache(isolate, wire_bytes, {})
+            .is_null());
+  CHECK(!FileExists(path));
+
+  // A file that is too short for its wire bytes is rejected before anything
+  // is allocated, even if {wire_bytes_size + data_size} wraps around to the
+  // actual size. The header starts with the two sizes.
+  constexpr size_t kHeaderSize = 2 * sizeof(uint64_t) + 2 * 32;
+  std::vector<uint8_t> short_file(contents.begin(),
+                                  contents.begin() + kHeaderSize + 1);
+  uint64_t wrapping_data_size = uint64_t{1} - wire_bytes.size();
+  memcpy(short_file.data() + sizeof(uint64_t), &wrapping_data_size,
+         sizeof(uint64_t));
+  WriteFileContents(path, base::VectorOf(short_file));
+  CHECK(DeserializeNativeModuleFromFileCache(isolate, wire_bytes, {})
+            .is_null());
+  CHECK(!FileExists(path));
+  base::OS::Remove(GetNativeModuleFileCachePrefixPath(wire_bytes).c_str());
+}
+
 TEST(TierDownAfterDeserialization) {
   WasmSerializationTest test;
 
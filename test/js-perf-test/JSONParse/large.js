@@ -0,0 +1,59 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Parses payloads that are large enough for the result to survive scavenges.
+// The results are kept alive for a while, like an application would.
+
+(function() {
+
+const kRetained = 4;
+let input;
+let retained = [];
+
+function RecordsSetup() {
+  let records = [];
+  for (let i = 0; i < 20000; ++i) {
+    records.push({
+      id: i,
+      name: 'record-' + i,
+      score: i / 7,
+      tags: ['a', 'b', 'c'],
+      active: i % 2 == 0
+    });
+  }
+  input = JSON.stringify(records);
+  retained = [];
+}
+
+function NestedSetup() {
+  let records = [];
+  for (let i = 0; i < 10000; ++i) {
+    records.push({
+      id: i,
+      user: {name: 'user-' + i, email: 'user' + i + '@example.com'},
+      location: {lat: i / 3, lng: -i / 5},
+      stats: {views: i * 3, likes: i % 17}
+    });
+  }
+  input = JSON.stringify(records);
+  retained = [];
+}
+
+function NumbersSetup() {
+  let numbers = [];
+  for (let i = 0; i < 200000; ++i) numbers.push(i * 1.5);
+  input = JSON.stringify({numbers});
+  retained = [];
+}
+
+function Parse() {
+  retained.push(JSON.parse(input));
+  if (retained.length > kRetained) retained.shift();
+}
+
+createSuite('Large-Records', 100, Parse, RecordsSetup);
+createSuite('Large-Nested', 100, Parse, NestedSetup);
+createSuite('Large-Numbers', 100, Parse, NumbersSetup);
+
+})();
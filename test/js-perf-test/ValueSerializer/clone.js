@@ -0,0 +1,46 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+(function() {
+
+const kLength = 10000;
+let value;
+let data;
+
+function SmiArraySetup() {
+  value = [];
+  for (let i = 0; i < kLength; ++i) value.push(i);
+  data = d8.serializer.serialize(value);
+}
+
+function DoubleArraySetup() {
+  value = [];
+  for (let i = 0; i < kLength; ++i) value.push(i + 0.5);
+  data = d8.serializer.serialize(value);
+}
+
+function ObjectArraySetup() {
+  value = [];
+  for (let i = 0; i < kLength / 10; ++i) {
+    value.push({id: i, x: i + 0.5, y: -i, name: 'point', visible: true});
+  }
+  data = d8.serializer.serialize(value);
+}
+
+function Serialize() {
+  d8.serializer.serialize(value);
+}
+
+function Deserialize() {
+  d8.serializer.deserialize(data);
+}
+
+createSuite('Serialize-SmiArray', 100, Serialize, SmiArraySetup);
+createSuite('Deserialize-SmiArray', 100, Deserialize, SmiArraySetup);
+createSuite('Serialize-DoubleArray', 100, Serialize, DoubleArraySetup);
+createSuite('Deserialize-DoubleArray', 100, Deserialize, DoubleArraySetup);
+createSuite('Serialize-ObjectArray', 100, Serialize, ObjectArraySetup);
+createSuite('Deserialize-ObjectArray', 100, Deserialize, ObjectArraySetup);
+
+})();
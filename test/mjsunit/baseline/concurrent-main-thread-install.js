@@ -0,0 +1,20 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --sparkplug --no-always-sparkplug --concurrent-sparkplug
+// Flags: --no-concurrent-sparkplug-off-thread-install
+// Flags: --baseline-batch-compilation-threshold=0
+// Flags: --no-turbofan --no-maglev --allow-natives-syntax
+
+// Without off-thread installation, the code is only installed once the main
+// thread finalizes the batch.
+function g(a, b) {
+  return a * b + 1;
+}
+%NeverOptimizeFunction(g);
+g(1, 2);
+assertFalse(%CompileBaselineInBackground(g));
+%CompileBaseline(g);
+assertEquals(7, g(2, 3));
+assertTrue(%ActiveTierIsSparkplug(g));
@@ -0,0 +1,38 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --sparkplug --no-always-sparkplug --concurrent-sparkplug
+// Flags: --concurrent-sparkplug-off-thread-install
+// Flags: --baseline-batch-compilation-threshold=0
+// Flags: --invocation-count-for-feedback-allocation=1
+// Flags: --no-turbofan --no-maglev --allow-natives-syntax
+
+// Installation happens on a background thread at an unspecified time, so only
+// check that the results are the same whichever tier runs.
+function make(k) {
+  return function(a, b) {
+    return (a + b + k) * 42 / (a + 1) % (b + 1);
+  };
+}
+
+const functions = [];
+for (let i = 0; i < 20; ++i) functions.push(make(i));
+
+const expected = functions.map(f => f(3, 4711));
+for (let round = 0; round < 200; ++round) {
+  for (let i = 0; i < functions.length; ++i) {
+    assertEquals(expected[i], functions[i](3, 4711));
+  }
+}
+
+// The background job installs the code itself, before the main thread gets to
+// finalize the batch.
+function g(a, b) {
+  return a * b + 1;
+}
+%NeverOptimizeFunction(g);
+g(1, 2);
+assertTrue(%CompileBaselineInBackground(g));
+assertEquals(7, g(2, 3));
+assertTrue(%ActiveTierIsSparkplug(g));
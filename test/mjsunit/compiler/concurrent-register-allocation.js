@@ -0,0 +1,34 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-concurrent-register-allocation
+// Flags: --turbo-concurrent-register-allocation-min-instructions=0
+
+// Mixes many live general and FP values, so that both allocators have to
+// split and spill while running concurrently.
+function mix(a, b, n) {
+  let x = a + 0.5, y = b * 1.5, z = a - b;
+  let i0 = a | 0, i1 = b | 0, i2 = n | 0;
+  let result = 0;
+  for (let i = 0; i < n; i++) {
+    x = x * 0.75 + y;
+    y = y - z * 0.25;
+    z = Math.sqrt(x * x + y * y) + i;
+    i0 = (i0 + i) | 0;
+    i1 = (i1 ^ i0) | 0;
+    i2 = (i2 + (i1 >> 1)) | 0;
+    if (i & 1) {
+      result += x - y;
+    } else {
+      result -= z + i2;
+    }
+  }
+  return result + x + y + z + i0 + i1 + i2;
+}
+
+%PrepareFunctionForOptimization(mix);
+const expected = [mix(1, 2, 10), mix(3.5, -1.25, 100)];
+%OptimizeFunctionOnNextCall(mix);
+assertEquals(expected[0], mix(1, 2, 10));
+assertEquals(expected[1], mix(3.5, -1.25, 100));
@@ -0,0 +1,31 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan --no-always-turbofan
+// Flags: --deopt-loop-detection --deopt-loop-threshold=1
+
+function load(o) {
+  return o.x;
+}
+
+%PrepareFunctionForOptimization(load);
+assertEquals(1, load({x: 1}));
+%OptimizeFunctionOnNextCall(load);
+assertEquals(1, load({x: 1}));
+assertOptimized(load);
+
+// A wrong map deopt hits the threshold right away, so the property load is
+// made megamorphic instead of picking up a second map.
+assertEquals(2, load({y: 0, x: 2}));
+assertUnoptimized(load);
+
+%PrepareFunctionForOptimization(load);
+%OptimizeFunctionOnNextCall(load);
+assertEquals(3, load({x: 3}));
+assertOptimized(load);
+
+// The reoptimized code uses a generic load and survives new maps.
+assertEquals(4, load({z: 0, x: 4}));
+assertEquals(5, load({w: 0, x: 5}));
+assertOptimized(load);
@@ -0,0 +1,30 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --json-parse-pretenure-threshold=200
+
+// The result of parsing a large input is allocated in old space.
+let input = JSON.stringify({
+  numbers: [1, 2, 3.5],
+  objects: [{a: 1, b: 'x'.repeat(10) + 'y', c: 0.5}, {a: 2, b: '\\n', c: 1}],
+  padding: 'p'.repeat(200)
+});
+let result = JSON.parse(input);
+assertEquals(input, JSON.stringify(result));
+assertFalse(%InYoungGeneration(result));
+assertFalse(%InYoungGeneration(result.numbers));
+assertFalse(%InYoungGeneration(result.objects[0]));
+assertFalse(%InYoungGeneration(result.objects[0].b));
+assertFalse(%InYoungGeneration(result.objects[1]));
+assertFalse(%InYoungGeneration(result.padding));
+
+// Mutating the parsed objects still works.
+result.objects[0].c = 2.5;
+result.objects[0].d = {};
+result.numbers.push(4);
+assertEquals(2.5, result.objects[0].c);
+assertEquals([1, 2, 3.5, 4], result.numbers);
+
+// Small inputs are unaffected.
+assertEquals({a: [1, 2]}, JSON.parse('{"a": [1, 2]}'));
@@ -0,0 +1,90 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --dump-counters --json-parse-shape-cache
+
+const padding = 'p'.repeat(1024);
+
+// The number of objects in the last parse that took their map from the cache.
+let cacheHits;
+
+function Parse(value, pad = padding) {
+  let input = JSON.stringify({value, pad});
+  let hitsBefore = %JsonParseShapeCacheHits();
+  let result = JSON.parse(input);
+  cacheHits = %JsonParseShapeCacheHits() - hitsBefore;
+  assertEquals(input, JSON.stringify(result));
+  return result.value;
+}
+
+// Objects nested in array elements take their maps from the objects nested in
+// earlier elements: Only the first record misses the cache.
+let records = Parse([
+  {id: 1, user: {name: 'a', age: 1}, pos: {x: 1.5, y: 2}},
+  {id: 2, user: {name: 'b', age: 2}, pos: {x: 3, y: 4.5}},
+  {id: 3, user: {name: 'c', age: 3}, pos: {x: 5, y: 6}}
+]);
+assertTrue(%HaveSameMap(records[0].user, records[1].user));
+assertTrue(%HaveSameMap(records[1].user, records[2].user));
+assertTrue(%HaveSameMap(records[0].pos, records[2].pos));
+assertEquals(4, cacheHits);
+assertEquals(3, records[2].user.age);
+assertEquals(4.5, records[1].pos.y);
+
+// So do objects in different arrays.
+let lists = Parse({
+  first: [{key: 'a', count: 1}],
+  second: [{key: 'b', count: 2}]
+});
+assertTrue(%HaveSameMap(lists.first[0], lists.second[0]));
+assertEquals(1, cacheHits);
+
+// Short inputs don't use the cache.
+Parse([{a: {b: 1}}, {a: {b: 2}}], '');
+assertEquals(0, cacheHits);
+
+// Objects that start with the same key but diverge later get their own maps.
+let diverging = Parse([
+  {outer: {a: 1, b: 2}},
+  {outer: {a: 1, c: 2}},
+  {outer: {a: 1}},
+  {outer: {a: 1, b: 2, c: 3}}
+]);
+assertEquals({a: 1, c: 2}, diverging[1].outer);
+assertEquals({a: 1}, diverging[2].outer);
+assertEquals({a: 1, b: 2, c: 3}, diverging[3].outer);
+assertFalse(%HaveSameMap(diverging[0].outer, diverging[1].outer));
+
+// Field representations are generalized as needed.
+let generalized = Parse([
+  {n: {v: 1}},
+  {n: {v: 1.5}},
+  {n: {v: 'x'}},
+  {n: {v: {w: 1}}}
+]);
+assertEquals(1, generalized[0].n.v);
+assertEquals(1.5, generalized[1].n.v);
+assertEquals('x', generalized[2].n.v);
+assertEquals({w: 1}, generalized[3].n.v);
+generalized[0].n.v = 2;
+assertEquals(2, generalized[0].n.v);
+
+// Keys with escapes, index keys and many keys are handled.
+let special = Parse([
+  {o: {'a\nb': 1, c: 2}},
+  {o: {'a\nb': 3, c: 4}},
+  {o: {0: 'x', 1: 'y'}},
+  {o: {0: 'z', d: 'w'}},
+  {o: {['k'.repeat(100)]: 1}},
+  {o: {['k'.repeat(100)]: 2}}
+]);
+assertEquals(3, special[1].o['a\nb']);
+assertEquals('y', special[2].o[1]);
+assertEquals('w', special[3].o.d);
+assertEquals(2, special[5].o['k'.repeat(100)]);
+
+let many = {};
+for (let i = 0; i < 2000; i++) many['k' + i] = i;
+let dictionaries = Parse([{m: many}, {m: many}]);
+assertEquals(1999, dictionaries[1].m.k1999);
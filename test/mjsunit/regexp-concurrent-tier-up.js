@@ -0,0 +1,62 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-tier-up --regexp-tier-up-ticks=1 --regexp-concurrent-tier-up
+// Flags: --allow-natives-syntax --no-force-slow-path --no-regexp-interpret-all
+// Flags: --no-enable-experimental-regexp-engine
+
+const kLatin1 = true;
+
+function CheckInterpreted(regexp) {
+  assertTrue(%RegexpHasBytecode(regexp, kLatin1));
+}
+
+function CheckTieredUp(regexp) {
+  assertFalse(%RegexpHasBytecode(regexp, kLatin1));
+  assertTrue(%RegexpHasNativeCode(regexp, kLatin1));
+}
+
+// The regexp keeps being interpreted while the tier-up compilation runs in the
+// background, and uses the native code once it has finished.
+let re = /(\d+)-(\w+)/;
+assertEquals(['12-ab', '12', 'ab'], re.exec('x12-ab'));
+CheckInterpreted(re);
+assertEquals(['3-c', '3', 'c'], re.exec('3-c'));
+CheckInterpreted(re);
+assertNull(re.exec('abc'));
+%RegexpFinishConcurrentTierUp();
+assertEquals(['45-de', '45', 'de'], re.exec('__45-de'));
+CheckTieredUp(re);
+assertEquals(['6-f', '6', 'f'], re.exec('6-f'));
+CheckTieredUp(re);
+
+// Named captures are installed with the native code.
+re = /(?<year>\d{4})-(?<month>\d{2})/;
+assertEquals('2020', re.exec('2020-01').groups.year);
+assertEquals('02', re.exec('2021-02').groups.month);
+%RegexpFinishConcurrentTierUp();
+let match = re.exec('on 2022-03');
+assertEquals('2022', match.groups.year);
+assertEquals('03', match.groups.month);
+CheckTieredUp(re);
+
+// Case-insensitive regexps tier up synchronously.
+re = /abc/i;
+assertTrue(re.test('ABC'));
+assertTrue(re.test('aBc'));
+CheckTieredUp(re);
+
+// So do regexps that are executed on long subjects.
+re = /x+y/;
+assertTrue(re.test('xxy'));
+assertTrue(re.test('x'.repeat(2000) + 'y'));
+CheckTieredUp(re);
+
+// Syntax that's only checked by the compiler is handled in either tier.
+re = /(a)|b\1/;
+assertEquals(['b', undefined], re.exec('b'));
+assertEquals(['a', 'a'], re.exec('a'));
+%RegexpFinishConcurrentTierUp();
+assertEquals(['b', undefined], re.exec('cb'));
+CheckTieredUp(re);
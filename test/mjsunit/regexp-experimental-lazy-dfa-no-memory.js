@@ -0,0 +1,21 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --default-to-experimental-regexp-engine
+// Flags: --experimental-regexp-engine-lazy-dfa
+// Flags: --experimental-regexp-engine-lazy-dfa-max-memory=0
+// Files: test/mjsunit/regexp-experimental-lazy-dfa.js
+
+// With no memory for DFA states, every execution falls back to the NFA right
+// away. The results must be the same as with the full DFA.
+
+// A pattern with many DFA states, on a subject which visits many of them
+// before the only match.
+let letters = '';
+for (let i = 0; i < 5000; i++) {
+  letters += 'abcdefghijklmnopqrstuvwxy'[(i * 7919) % 25];
+}
+Test(/x[a-y]{8}z/, letters + 'xabcdefghz' + letters,
+     Match(['xabcdefghz'], letters.length), 0);
+Test(/x[a-y]{8}z/, letters, null, 0);
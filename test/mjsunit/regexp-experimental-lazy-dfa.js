@@ -0,0 +1,70 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --default-to-experimental-regexp-engine
+// Flags: --experimental-regexp-engine-lazy-dfa
+
+function Test(regexp, subject, expectedResult, expectedLastIndex) {
+  assertEquals(%RegexpTypeTag(regexp), 'EXPERIMENTAL');
+  var result = regexp.exec(subject);
+  if (result instanceof Array && expectedResult instanceof Array) {
+    assertArrayEquals(expectedResult, result);
+    assertEquals(expectedResult.index, result.index);
+  } else {
+    assertEquals(expectedResult, result);
+  }
+  assertEquals(expectedLastIndex, regexp.lastIndex);
+}
+
+function Match(array, index) {
+  array.index = index;
+  return array;
+}
+
+// No match.
+Test(/abc/, 'ababababab', null, 0);
+Test(/a[0-9]+z/, 'a1234y a5678', null, 0);
+Test(/x*y/, '', null, 0);
+
+// The match starts after partial matches that failed.
+Test(/a*b/, 'xxaab', Match(['aab'], 2), 0);
+Test(/a*b/, 'xaxaab', Match(['aab'], 3), 0);
+Test(/abcd/, 'abcabcabcd', Match(['abcd'], 6), 0);
+Test(/(a+)(b+)c/, 'aabbaabbbc', Match(['aabbbc', 'aa', 'bbb'], 4), 0);
+
+// Priorities of alternatives and quantifiers.
+Test(/abc|..|[a-c]{10,}/, 'abcccccccccccccc', Match(['abc'], 0), 0);
+Test(/x*?a/, 'xxaa', Match(['xxa'], 0), 0);
+Test(/(x|xy)(yz|z)/, 'qxyz', Match(['xyz', 'x', 'yz'], 1), 0);
+Test(/(?:a|ab)*c/, 'ababc', Match(['ababc'], 0), 0);
+
+// Empty matches and empty loop iterations.
+Test(/(?:)/, 'asdf', Match([''], 0), 0);
+Test(/(?:a*)*b/, 'aac', null, 0);
+Test(/(?:a*)*b/, 'aacb', Match(['b'], 3), 0);
+
+// Sticky and global regexps.
+let sticky = /ab/y;
+sticky.lastIndex = 2;
+Test(sticky, 'abab', Match(['ab'], 2), 4);
+Test(sticky, 'abab', null, 0);
+assertEquals(['a1', 'a22', 'a333'], 'a1 b2 a22 a333 a'.match(/a[0-9]+/g));
+assertEquals('x-y-z', 'x0y12z'.replace(/[0-9]+/g, '-'));
+
+// Two-byte subjects and characters outside the one-byte range.
+Test(/쁰d섊/, '123쁰쁰d섊abc', Match(['쁰d섊'], 4), 0);
+Test(/[^a]+/, 'aa\u{ffff}\u{100}a', Match(['\u{ffff}\u{100}'], 2), 0);
+Test(/[Ā-￿]b/, 'abĀa￿b', Match(['￿b'], 4), 0);
+
+// Patterns the DFA does not handle.
+Test(/^abc$/m, 'x\nabc\ny', Match(['abc'], 2), 0);
+Test(/\bfoo\b/, 'afoo foo', Match(['foo'], 5), 0);
+Test(/(?<=a)b/, 'bab', Match(['b'], 2), 0);
+
+// Long subjects.
+let haystack = 'x'.repeat(100000);
+Test(/needle/, haystack, null, 0);
+Test(/ne+dle/, haystack + 'needle' + haystack, Match(['needle'], 100000), 0);
+Test(/(\d+)-(\d+)/, haystack + '12-345', Match(['12-345', '12', '345'], 100000),
+     0);
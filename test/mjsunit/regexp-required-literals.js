@@ -0,0 +1,98 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-required-literals --no-regexp-tier-up
+
+function Match(array, index) {
+  array.index = index;
+  return array;
+}
+
+function Test(regexp, subject, expected) {
+  var result = regexp.exec(subject);
+  if (expected === null) {
+    assertNull(result);
+  } else {
+    assertArrayEquals(expected, result);
+    assertEquals(expected.index, result.index);
+  }
+}
+
+// The long subjects exercise the vectorized search and its scalar tail. The
+// short ones are too short to be searched.
+const padding = 'x'.repeat(1000);
+for (const pad of ['', padding]) {
+  // Literals in the middle of the pattern.
+  Test(/\d+ ERROR: (.*)/, pad + '12 ERROR: disk full',
+       Match(['12 ERROR: disk full', 'disk full'], pad.length));
+  Test(/\d+ ERROR: (.*)/, pad + '12 WARNING: disk full', null);
+  Test(/\w+@example\.com/, pad + 'mail bob@example.com',
+       Match(['bob@example.com'], pad.length + 5));
+  Test(/\w+@example\.com/, pad + 'mail bob@example.org', null);
+
+  // Sets of literals.
+  Test(/(GET|POST) \/api/, pad + 'POST /api',
+       Match(['POST /api', 'POST'], pad.length));
+  Test(/(GET|POST) \/api/, pad + 'PUT /api', null);
+  Test(/a(?:bcd|ef|g+h)z/, pad + 'aggghz', Match(['aggghz'], pad.length));
+  Test(/a(?:bcd|ef|g+h)z/, pad + 'aghx', null);
+
+  // Literals of one character, and at the very end of the subject.
+  Test(/[0-9]+;/, pad + '123;', Match(['123;'], pad.length));
+  Test(/[0-9]+;/, pad + '123', null);
+  Test(/[a-z]+abc/, pad + 'zabc', Match([pad + 'zabc'], 0));
+
+  // Literals inside lookarounds are not required.
+  Test(/(?<=foo)\d+/, pad + 'foo12', Match(['12'], pad.length + 3));
+  Test(/\d+(?!bar)/, pad + '12', Match(['12'], pad.length));
+  Test(/\d+(?=bar)/, pad + '12bar', Match(['12'], pad.length));
+
+  // Optional parts don't contribute literals.
+  Test(/(?:abc)?\d+/, pad + '42', Match(['42'], pad.length));
+  Test(/(?:abc|)\d+/, pad + '42', Match(['42'], pad.length));
+  Test(/\d+(?:abc)*/, pad + '42', Match(['42'], pad.length));
+
+  // Case-insensitive patterns and groups.
+  Test(/ERROR/i, pad + 'error', Match(['error'], pad.length));
+  Test(/x(?i:error)/, pad + 'xError', Match(['xError'], pad.length));
+
+  // Two-byte subjects.
+  Test(/\d+ fehler/, pad + '☃ 12 fehler',
+       Match(['12 fehler'], pad.length + 2));
+  Test(/\d+ fehler/, pad + '☃ 12 feh1er', null);
+  Test(/(☃|☄)+!/, pad + 'a☄☃!', Match(['☄☃!', '☃'], pad.length + 1));
+  Test(/(☃|☄)+!/, pad + 'a☄☃?', null);
+
+  // Two-byte literals can't occur in one-byte subjects.
+  Test(/\w☃/, pad + 'a', null);
+  Test(/\w(?:☃|b)/, pad + 'ab', Match(['ab'], pad.length));
+
+  // Astral characters in unicode mode.
+  Test(/\u{1F600}+\d/u, pad + '\u{1F600}\u{1F600}1',
+       Match(['\u{1F600}\u{1F600}1'], pad.length));
+  // A lastIndex inside a surrogate pair is moved back to the pair's start.
+  let unicode = /\u{1F600}/gu;
+  unicode.lastIndex = pad.length + 1;
+  Test(unicode, pad + '\u{1F600}', Match(['\u{1F600}'], pad.length));
+}
+
+// Global regexps search again from the position after the last match.
+assertEquals(['a1;', 'b22;', 'c;'], 'a1; b22; c; d'.match(/[a-z]\d*;/g));
+assertEquals('a-b-c', 'a--->b--->c'.replace(/-+>/g, '-'));
+assertEquals(['12 fehler', '3 fehler'],
+             (padding + '12 fehler☃ 3 fehler').match(/\d+ fehler/g));
+// Many matches in a long subject, and none after the last one.
+assertEquals(1000, (padding + 'a1;'.repeat(1000) + padding)
+                       .match(/[a-z]\d*;/g).length);
+assertEquals(padding + '-'.repeat(1000) + padding,
+             (padding + 'ERROR'.repeat(1000) + padding).replace(/ERROR/g, '-'));
+
+// Sticky regexps and lastIndex.
+let sticky = /\d+;/y;
+sticky.lastIndex = 2;
+Test(sticky, 'ab12;', Match(['12;'], 2));
+let global = /\d+;/g;
+global.lastIndex = 3;
+Test(global, '12;34;', Match(['34;'], 3));
+Test(global, '12;34;', null);
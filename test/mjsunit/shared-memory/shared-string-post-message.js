@@ -0,0 +1,37 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --shared-string-table --allow-natives-syntax
+
+if (this.Worker) {
+
+(function TestLongStringsArePassedByReference() {
+  function workerCode() {
+    onmessage = function({data}) {
+      postMessage({
+        long_is_shared: %IsSharedString(data.long),
+        short_is_shared: %IsSharedString(data.short),
+        long: data.long,
+        nested: data.nested[0]
+      });
+    };
+  }
+
+  let worker = new Worker(workerCode, {type: 'function'});
+  // Build the strings at runtime so that they aren't internalized.
+  let long = 'x'.repeat(1000) + Math.random();
+  let short = 'y'.repeat(10) + Math.random();
+  worker.postMessage({long, short, nested: [long]});
+
+  let reply = worker.getMessage();
+  assertTrue(reply.long_is_shared);
+  assertFalse(reply.short_is_shared);
+  assertEquals(long, reply.long);
+  assertEquals(long, reply.nested);
+  assertTrue(%IsSharedString(reply.long));
+
+  worker.terminate();
+})();
+
+}
@@ -0,0 +1,49 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --expose-gc --wasm-lazy-compilation
+// Flags: --wasm-reuse-freed-code-space --stress-wasm-code-gc
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+const builder = new WasmModuleBuilder();
+for (let i = 0; i < 8; ++i) {
+  builder.addFunction('f' + i, kSig_i_i)
+      .addBody([kExprLocalGet, 0, ...wasmI32Const(i), kExprI32Add])
+      .exportFunc();
+}
+const instance = builder.instantiate();
+const exports = instance.exports;
+
+function callAll() {
+  for (let i = 0; i < 8; ++i) {
+    assertEquals(10 + i, exports['f' + i](10));
+  }
+}
+
+// Compile all functions with Liftoff once. Afterwards, flushing and lazily
+// recompiling the same Liftoff code must not use any fresh code space: the new
+// code lands in the space of the freed code. (With --stress-wasm-code-gc, the
+// flushed code is freed when callAll handles the pending code GC interrupt on
+// entry, before anything gets recompiled.)
+callAll();
+const unused_code_space = %WasmUnusedCodeSpace(instance);
+for (let round = 0; round < 4; ++round) {
+  %FlushLiftoffCode();
+  gc();
+  callAll();
+  assertEquals(unused_code_space, %WasmUnusedCodeSpace(instance));
+}
+
+// Tier up some functions in between, so that freed and live code interleave.
+for (let round = 0; round < 4; ++round) {
+  callAll();
+  %WasmTierUpFunction(exports['f' + (2 * round)]);
+  %FlushLiftoffCode();
+  gc();
+  callAll();
+}
+for (let i = 0; i < 8; i += 2) {
+  assertTrue(%IsTurboFanFunction(exports['f' + i]));
+}
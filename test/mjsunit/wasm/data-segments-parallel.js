@@ -0,0 +1,77 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-parallel-data-segments --wasm-parallel-data-segments-min-kb=1
+
+d8.file.execute("test/mjsunit/wasm/wasm-module-builder.js");
+
+const kSegmentSize = 300 * 1024;
+
+function makeSegment(size, seed) {
+  let data = new Array(size);
+  for (let i = 0; i < size; ++i) data[i] = (i * 7 + seed) & 0xff;
+  return data;
+}
+
+function checkSegment(view, offset, data) {
+  for (let i = 0; i < data.length; ++i) {
+    if (view[offset + i] != data[i]) {
+      assertEquals(data[i], view[offset + i], `at ${offset + i}`);
+    }
+  }
+}
+
+(function TestLargeSegments() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  builder.addMemory(20, 20);
+  builder.exportMemoryAs("memory");
+  let segments = [];
+  for (let i = 0; i < 3; ++i) {
+    let offset = i * 5 * kPageSize + 17;
+    let data = makeSegment(kSegmentSize + i, i);
+    builder.addActiveDataSegment(0, wasmI32Const(offset), data);
+    segments.push([offset, data]);
+  }
+  builder.addPassiveDataSegment([1, 2, 3]);
+  let view = new Uint8Array(builder.instantiate().exports.memory.buffer);
+  for (let [offset, data] of segments) checkSegment(view, offset, data);
+  assertEquals(0, view[16]);
+  assertEquals(0, view[17 + kSegmentSize]);
+})();
+
+(function TestOverlappingSegments() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  builder.addMemory(10, 10);
+  builder.exportMemoryAs("memory");
+  let first = makeSegment(kSegmentSize, 1);
+  let second = makeSegment(kSegmentSize, 2);
+  builder.addActiveDataSegment(0, wasmI32Const(0), first);
+  builder.addActiveDataSegment(0, wasmI32Const(1000), second);
+  let view = new Uint8Array(builder.instantiate().exports.memory.buffer);
+  // The later segment wins.
+  checkSegment(view, 0, first.slice(0, 1000));
+  checkSegment(view, 1000, second);
+})();
+
+(function TestOutOfBoundsSegment() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  builder.addImportedMemory("m", "memory", 20, 20);
+  let data = makeSegment(kSegmentSize, 3);
+  builder.addActiveDataSegment(0, wasmI32Const(0), data);
+  builder.addActiveDataSegment(0, wasmI32Const(kSegmentSize), data);
+  builder.addActiveDataSegment(0, wasmI32Const(20 * kPageSize - 10), data);
+  builder.addActiveDataSegment(0, wasmI32Const(1000000), data);
+  let memory = new WebAssembly.Memory({initial: 20, maximum: 20});
+  assertThrows(
+      () => builder.instantiate({m: {memory}}), WebAssembly.RuntimeError,
+      /data segment 2 is out of bounds/);
+  // Segments before the failing one were written, later ones were not.
+  let view = new Uint8Array(memory.buffer);
+  checkSegment(view, 0, data);
+  checkSegment(view, kSegmentSize, data);
+  assertEquals(0, view[1000001]);
+})();
@@ -0,0 +1,227 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --no-liftoff --no-wasm-lazy-compilation
+// Flags: --turboshaft-wasm-escape-analysis
+
+// Tests scalar replacement of non-escaping structs. The Turboshaft graphs can
+// be examined with --trace-turbo.
+d8.file.execute("test/mjsunit/wasm/wasm-module-builder.js");
+
+(function EscapeAnalysisBranchesTest() {
+  print(arguments.callee.name);
+
+  let builder = new WasmModuleBuilder();
+  let struct = builder.addStruct([makeField(kWasmI32, true),
+                                  makeField(kWasmI64, true)]);
+
+  builder.addFunction("main", makeSig([kWasmI32], [kWasmI64]))
+    .addLocals(wasmRefNullType(struct), 1)
+    .addBody([
+      kExprLocalGet, 0,  // local1 = struct(param0, 100);
+      ...wasmI64Const(100),
+      kGCPrefix, kExprStructNew, struct,
+      kExprLocalSet, 1,
+      kExprLocalGet, 0,
+      kExprIf, kWasmVoid,
+        kExprLocalGet, 1,  // local1.field1 = local1.field0 * 2
+        kExprLocalGet, 1,
+        kGCPrefix, kExprStructGet, struct, 0,
+        kExprI32Const, 1,
+        kExprI32Shl,
+        kExprI64SConvertI32,
+        kGCPrefix, kExprStructSet, struct, 1,
+      kExprElse,
+        kExprLocalGet, 1,  // local1.field0 = 7
+        kExprI32Const, 7,
+        kGCPrefix, kExprStructSet, struct, 0,
+      kExprEnd,
+      kExprLocalGet, 1,  // return local1.field0 + local1.field1
+      kGCPrefix, kExprStructGet, struct, 0,
+      kExprI64SConvertI32,
+      kExprLocalGet, 1,
+      kGCPrefix, kExprStructGet, struct, 1,
+      kExprI64Add,
+    ])
+    .exportFunc();
+
+  let instance = builder.instantiate({});
+  assertEquals(5n + 10n, instance.exports.main(5));
+  assertEquals(-3n - 6n, instance.exports.main(-3));
+  assertEquals(7n + 100n, instance.exports.main(0));
+})();
+
+(function EscapeAnalysisLoopTest() {
+  print(arguments.callee.name);
+
+  let builder = new WasmModuleBuilder();
+  let struct = builder.addStruct([makeField(kWasmI32, true),
+                                  makeField(kWasmF64, true)]);
+
+  // Sums up 0..n-1 into field 0 and counts down from n in field 1.
+  builder.addFunction("main", makeSig([kWasmI32], [kWasmF64]))
+    .addLocals(wasmRefType(struct), 1)
+    .addBody([
+      kExprI32Const, 0,
+      kExprLocalGet, 0,
+      kExprF64SConvertI32,
+      kGCPrefix, kExprStructNew, struct,
+      kExprLocalSet, 1,
+      kExprBlock, kWasmVoid,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 1,
+          kGCPrefix, kExprStructGet, struct, 1,
+          ...wasmF64Const(0),
+          kExprF64Le,
+          kExprBrIf, 1,
+          kExprLocalGet, 1,
+          kExprLocalGet, 1,
+          kGCPrefix, kExprStructGet, struct, 0,
+          kExprLocalGet, 1,
+          kGCPrefix, kExprStructGet, struct, 1,
+          kExprI32SConvertF64,
+          kExprI32Add,
+          kExprI32Const, 1,
+          kExprI32Sub,
+          kGCPrefix, kExprStructSet, struct, 0,
+          kExprLocalGet, 1,
+          kExprLocalGet, 1,
+          kGCPrefix, kExprStructGet, struct, 1,
+          ...wasmF64Const(1),
+          kExprF64Sub,
+          kGCPrefix, kExprStructSet, struct, 1,
+          kExprBr, 0,
+        kExprEnd,
+      kExprEnd,
+      kExprLocalGet, 1,
+      kGCPrefix, kExprStructGet, struct, 0,
+      kExprF64SConvertI32,
+      kExprLocalGet, 1,
+      kGCPrefix, kExprStructGet, struct, 1,
+      kExprF64Add,
+    ])
+    .exportFunc();
+
+  let instance = builder.instantiate({});
+  assertEquals(0, instance.exports.main(0));
+  assertEquals(45, instance.exports.main(10));
+  assertEquals(4950, instance.exports.main(100));
+})();
+
+(function EscapeAnalysisEscapingTest() {
+  print(arguments.callee.name);
+
+  let builder = new WasmModuleBuilder();
+  let struct = builder.addStruct([makeField(kWasmI32, true)]);
+  let outer = builder.addStruct([makeField(wasmRefNullType(struct), true),
+                                 makeField(kWasmI32, true)]);
+  let global = builder.addGlobal(wasmRefNullType(struct), true, false,
+                                 [kGCPrefix, kExprRefNull, struct]);
+
+  // The inner struct escapes by being stored into the (non-escaping) outer
+  // struct and into a global.
+  builder.addFunction("main", makeSig([kWasmI32], [kWasmI32]))
+    .addLocals(wasmRefNullType(struct), 1)
+    .addLocals(wasmRefNullType(outer), 1)
+    .addBody([
+      kExprLocalGet, 0,
+      kGCPrefix, kExprStructNew, struct,
+      kExprLocalSet, 1,
+      kExprLocalGet, 1,
+      kExprI32Const, 1,
+      kGCPrefix, kExprStructNew, outer,
+      kExprLocalSet, 2,
+      kExprLocalGet, 0,
+      kExprIf, kWasmVoid,
+        kExprLocalGet, 1,
+        kExprGlobalSet, global.index,
+      kExprEnd,
+      kExprLocalGet, 1,  // local1.field0 += 1
+      kExprLocalGet, 1,
+      kGCPrefix, kExprStructGet, struct, 0,
+      kExprI32Const, 1,
+      kExprI32Add,
+      kGCPrefix, kExprStructSet, struct, 0,
+      kExprLocalGet, 2,  // return local2.field0.field0 + local2.field1
+      kGCPrefix, kExprStructGet, outer, 0,
+      kGCPrefix, kExprStructGet, struct, 0,
+      kExprLocalGet, 2,
+      kGCPrefix, kExprStructGet, outer, 1,
+      kExprI32Add,
+    ])
+    .exportFunc();
+  builder.addFunction("getGlobal", makeSig([], [kWasmI32]))
+    .addBody([
+      kExprGlobalGet, global.index,
+      kGCPrefix, kExprStructGet, struct, 0,
+    ])
+    .exportFunc();
+
+  let instance = builder.instantiate({});
+  assertEquals(12, instance.exports.main(10));
+  assertEquals(11, instance.exports.getGlobal());
+  assertEquals(2, instance.exports.main(0));
+  assertEquals(11, instance.exports.getGlobal());
+})();
+
+(function EscapeAnalysisIdentityTest() {
+  print(arguments.callee.name);
+
+  let builder = new WasmModuleBuilder();
+  let struct = builder.addStruct([makeField(kWasmI32, true)]);
+
+  // Comparing references makes the structs escape.
+  builder.addFunction("main", makeSig([kWasmI32], [kWasmI32]))
+    .addLocals(wasmRefNullType(struct), 2)
+    .addBody([
+      kExprLocalGet, 0,
+      kGCPrefix, kExprStructNew, struct,
+      kExprLocalTee, 1,
+      kExprLocalGet, 0,
+      kExprIf, kWasmRefNull, struct,
+        kExprLocalGet, 1,
+      kExprElse,
+        kExprI32Const, 0,
+        kGCPrefix, kExprStructNew, struct,
+      kExprEnd,
+      kExprLocalTee, 2,
+      kExprRefEq,
+      kExprLocalGet, 2,
+      kGCPrefix, kExprStructGet, struct, 0,
+      kExprI32Add,
+    ])
+    .exportFunc();
+
+  let instance = builder.instantiate({});
+  assertEquals(1 + 5, instance.exports.main(5));
+  assertEquals(0, instance.exports.main(0));
+})();
+
+(function EscapeAnalysisPackedFieldsTest() {
+  print(arguments.callee.name);
+
+  let builder = new WasmModuleBuilder();
+  let struct = builder.addStruct([makeField(kWasmI8, true),
+                                  makeField(kWasmI16, true)]);
+
+  // Structs with packed fields are not replaced.
+  builder.addFunction("main", makeSig([kWasmI32], [kWasmI32]))
+    .addLocals(wasmRefNullType(struct), 1)
+    .addBody([
+      kExprLocalGet, 0,
+      kExprLocalGet, 0,
+      kGCPrefix, kExprStructNew, struct,
+      kExprLocalSet, 1,
+      kExprLocalGet, 1,
+      kGCPrefix, kExprStructGetS, struct, 0,
+      kExprLocalGet, 1,
+      kGCPrefix, kExprStructGetU, struct, 1,
+      kExprI32Add,
+    ])
+    .exportFunc();
+
+  let instance = builder.instantiate({});
+  assertEquals(-1 + 0xffff, instance.exports.main(-1));
+  assertEquals(0x7f + 0x17f, instance.exports.main(0x17f));
+})();
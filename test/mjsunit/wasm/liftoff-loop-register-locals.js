@@ -0,0 +1,102 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --liftoff --no-wasm-tier-up
+// Flags: --no-wasm-lazy-compilation --wasm-liftoff-loop-register-locals=4
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+(function testLocalsSharingARegister() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  // Locals 1 and 2 are copies of param 0 when entering the loop; only local 2
+  // is updated in the loop.
+  builder.addFunction('main', kSig_i_i)
+      .addLocals(kWasmI32, 2)
+      .addBody([
+        kExprLocalGet, 0, kExprLocalTee, 1, kExprLocalSet, 2,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 2, kExprI32Const, 3, kExprI32Add, kExprLocalSet, 2,
+          kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub, kExprLocalTee, 0,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 1, kExprI32Const, 16, kExprI32Shl,
+        kExprLocalGet, 2, kExprI32Add,
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  assertTrue(%IsLiftoffFunction(instance.exports.main));
+  assertEquals((10 << 16) + 10 + 30, instance.exports.main(10));
+})();
+
+(function testManyLocalsUpdatedInLoop() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  // Rotates six locals in each iteration, more than are kept in registers.
+  builder.addFunction('main', kSig_i_i)
+      .addLocals(kWasmI32, 6)
+      .addBody([
+        ...wasmI32Const(1), kExprLocalSet, 1,
+        ...wasmI32Const(2), kExprLocalSet, 2,
+        ...wasmI32Const(3), kExprLocalSet, 3,
+        ...wasmI32Const(4), kExprLocalSet, 4,
+        ...wasmI32Const(5), kExprLocalSet, 5,
+        ...wasmI32Const(6), kExprLocalSet, 6,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 1,
+          kExprLocalGet, 2, kExprLocalSet, 1,
+          kExprLocalGet, 3, kExprLocalSet, 2,
+          kExprLocalGet, 4, kExprLocalSet, 3,
+          kExprLocalGet, 5, kExprLocalSet, 4,
+          kExprLocalGet, 6, kExprLocalSet, 5,
+          kExprLocalGet, 5, kExprI32Add, kExprLocalSet, 6,
+          kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub, kExprLocalTee, 0,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 1, kExprLocalGet, 2, kExprI32Add,
+        kExprLocalGet, 3, kExprI32Add, kExprLocalGet, 4, kExprI32Add,
+        kExprLocalGet, 5, kExprI32Add, kExprLocalGet, 6, kExprI32Add,
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+
+  function expected(n) {
+    let l = [1, 2, 3, 4, 5, 6];
+    do {
+      const first = l.shift();
+      l.push((first + l[4]) | 0);
+    } while (--n);
+    return l.reduce((a, b) => (a + b) | 0);
+  }
+  for (const n of [1, 2, 7, 100]) {
+    assertEquals(expected(n), instance.exports.main(n));
+  }
+})();
+
+(function testMixedKindsInLoop() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  // Sums {n} in an i64 and a f64 local, and counts iterations in an i32.
+  builder.addFunction('main', makeSig([kWasmI32], [kWasmF64]))
+      .addLocals(kWasmI64, 1)
+      .addLocals(kWasmF64, 1)
+      .addLocals(kWasmI32, 1)
+      .addBody([
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 1, kExprLocalGet, 0, kExprI64UConvertI32, kExprI64Add,
+          kExprLocalSet, 1,
+          kExprLocalGet, 2, kExprLocalGet, 0, kExprF64SConvertI32, kExprF64Add,
+          kExprLocalSet, 2,
+          kExprLocalGet, 3, kExprI32Const, 1, kExprI32Add, kExprLocalSet, 3,
+          kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub, kExprLocalTee, 0,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 1, kExprF64SConvertI64,
+        kExprLocalGet, 2, kExprF64Add,
+        kExprLocalGet, 3, kExprF64SConvertI32, kExprF64Add,
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  assertEquals(2 * (100 * 101 / 2) + 100, instance.exports.main(100));
+})();
@@ -0,0 +1,75 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --wasm-memory64-clamp-bounds-checks
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+const kMaxMemory64Size = 16n * 1024n * 1024n * 1024n;
+const kBigOffset = 2n ** 33n;
+
+const builder = new WasmModuleBuilder();
+builder.addMemory64(1);
+builder.exportMemoryAs('memory');
+builder.addFunction('load', kSig_i_l)
+    .addBody([kExprLocalGet, 0, kExprI32LoadMem, 0, 0])
+    .exportFunc();
+builder.addFunction('load_big_offset', kSig_i_l)
+    .addBody([
+      kExprLocalGet, 0,
+      kExprI32LoadMem, 0, ...wasmSignedLeb64(kBigOffset),
+    ])
+    .exportFunc();
+// The index stays on the value stack across the load.
+builder.addFunction('load_keep_index', kSig_i_l)
+    .addBody([
+      kExprLocalGet, 0, kExprLocalGet, 0, kExprI32LoadMem, 0, 0,
+      kExprDrop, kExprI32ConvertI64,
+    ])
+    .exportFunc();
+builder.addFunction('store', makeSig([kWasmI64, kWasmI32], []))
+    .addBody([kExprLocalGet, 0, kExprLocalGet, 1, kExprI32StoreMem, 0, 0])
+    .exportFunc();
+builder.addFunction('store8', makeSig([kWasmI64, kWasmI32], []))
+    .addBody([kExprLocalGet, 0, kExprLocalGet, 1, kExprI32StoreMem8, 0, 0])
+    .exportFunc();
+const instance = builder.instantiate();
+const {memory, load, load_big_offset, load_keep_index, store, store8} =
+    instance.exports;
+
+function runTests() {
+  const size = BigInt(memory.buffer.byteLength);
+  store(0n, 17);
+  assertEquals(17, load(0n));
+  store(size - 4n, 42);
+  assertEquals(42, load(size - 4n));
+  store8(size - 1n, 7);
+  assertEquals(7, load_keep_index(size - 1n) & 0xff);
+
+  for (const index of [size, size - 3n, kMaxMemory64Size - 4n,
+                       kMaxMemory64Size - 3n, kMaxMemory64Size,
+                       2n ** 63n, 2n ** 64n - 4n, -1n]) {
+    assertTraps(kTrapMemOutOfBounds, () => load(index));
+    assertTraps(kTrapMemOutOfBounds, () => load_keep_index(index));
+    assertTraps(kTrapMemOutOfBounds, () => store(index, 1));
+    assertTraps(kTrapMemOutOfBounds, () => store8(index, 1));
+  }
+  // `index + offset` wraps around to an in-bounds address.
+  assertTraps(kTrapMemOutOfBounds, () => load_big_offset(-kBigOffset));
+  assertTraps(kTrapMemOutOfBounds, () => load_big_offset(0n));
+  // Nothing was written by the trapping stores.
+  assertEquals(17, load(0n));
+  assertEquals(42, load(size - 4n));
+}
+
+runTests();
+memory.grow(1n);
+runTests();
+
+for (const f of [load, load_big_offset, load_keep_index, store, store8]) {
+  %WasmTierUpFunction(f);
+}
+runTests();
+memory.grow(1n);
+runTests();
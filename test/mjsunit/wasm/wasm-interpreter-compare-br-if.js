@@ -0,0 +1,130 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --drumbrake-super-instructions
+
+d8.file.execute("test/mjsunit/wasm/wasm-module-builder.js");
+
+// Comparisons followed by a br_if are merged into a single instruction
+// handler. Each comparison is tested with both operands in stack slots, and
+// with the right operand passed in a register.
+
+const kComparisons = [
+  [kWasmI32, kExprI32Eq, (a, b) => a == b],
+  [kWasmI32, kExprI32Ne, (a, b) => a != b],
+  [kWasmI32, kExprI32LtS, (a, b) => a < b],
+  [kWasmI32, kExprI32LtU, (a, b) => (a >>> 0) < (b >>> 0)],
+  [kWasmI32, kExprI32GtS, (a, b) => a > b],
+  [kWasmI32, kExprI32GtU, (a, b) => (a >>> 0) > (b >>> 0)],
+  [kWasmI32, kExprI32LeS, (a, b) => a <= b],
+  [kWasmI32, kExprI32LeU, (a, b) => (a >>> 0) <= (b >>> 0)],
+  [kWasmI32, kExprI32GeS, (a, b) => a >= b],
+  [kWasmI32, kExprI32GeU, (a, b) => (a >>> 0) >= (b >>> 0)],
+  [kWasmI64, kExprI64Eq, (a, b) => a == b],
+  [kWasmI64, kExprI64Ne, (a, b) => a != b],
+  [kWasmI64, kExprI64LtS, (a, b) => a < b],
+  [kWasmI64, kExprI64LtU,
+   (a, b) => BigInt.asUintN(64, a) < BigInt.asUintN(64, b)],
+  [kWasmI64, kExprI64GtS, (a, b) => a > b],
+  [kWasmI64, kExprI64GtU,
+   (a, b) => BigInt.asUintN(64, a) > BigInt.asUintN(64, b)],
+  [kWasmI64, kExprI64LeS, (a, b) => a <= b],
+  [kWasmI64, kExprI64LeU,
+   (a, b) => BigInt.asUintN(64, a) <= BigInt.asUintN(64, b)],
+  [kWasmI64, kExprI64GeS, (a, b) => a >= b],
+  [kWasmI64, kExprI64GeU,
+   (a, b) => BigInt.asUintN(64, a) >= BigInt.asUintN(64, b)],
+  [kWasmF32, kExprF32Eq, (a, b) => a == b],
+  [kWasmF32, kExprF32Ne, (a, b) => a != b],
+  [kWasmF32, kExprF32Lt, (a, b) => a < b],
+  [kWasmF32, kExprF32Gt, (a, b) => a > b],
+  [kWasmF32, kExprF32Le, (a, b) => a <= b],
+  [kWasmF32, kExprF32Ge, (a, b) => a >= b],
+  [kWasmF64, kExprF64Eq, (a, b) => a == b],
+  [kWasmF64, kExprF64Ne, (a, b) => a != b],
+  [kWasmF64, kExprF64Lt, (a, b) => a < b],
+  [kWasmF64, kExprF64Gt, (a, b) => a > b],
+  [kWasmF64, kExprF64Le, (a, b) => a <= b],
+  [kWasmF64, kExprF64Ge, (a, b) => a >= b],
+];
+
+const kValues = new Map([
+  [kWasmI32, [0, 1, -1, 17, 0x7fffffff, -0x80000000]],
+  [kWasmI64, [0n, 1n, -1n, 17n, 2n ** 63n - 1n, -(2n ** 63n)]],
+  [kWasmF32, [0, -0, 1.5, -1.5, Infinity, NaN]],
+  [kWasmF64, [0, -0, 1.5, -1.5, -Infinity, NaN]],
+]);
+
+// Produces the value of local 1 in a register: `local 1 + 0`.
+function rhsInRegister(type) {
+  switch (type) {
+    case kWasmI32:
+      return [kExprLocalGet, 1, kExprI32Const, 0, kExprI32Add];
+    case kWasmI64:
+      return [kExprLocalGet, 1, kExprI64Const, 0, kExprI64Add];
+    case kWasmF32:
+      return [kExprLocalGet, 1, kExprF32Abs, kExprLocalGet, 1,
+              kExprF32CopySign];
+    case kWasmF64:
+      return [kExprLocalGet, 1, kExprF64Abs, kExprLocalGet, 1,
+              kExprF64CopySign];
+  }
+}
+
+(function testCompareBrIf() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  kComparisons.forEach(([type, opcode], i) => {
+    const sig = makeSig([type, type], [kWasmI32]);
+    for (const [suffix, rhs] of [['s', [kExprLocalGet, 1]],
+                                 ['r', rhsInRegister(type)]]) {
+      builder.addFunction(`cmp${i}_${suffix}`, sig)
+          .addBody([
+            kExprBlock, kWasmVoid,
+              kExprLocalGet, 0, ...rhs, opcode,
+              kExprBrIf, 0,
+              kExprI32Const, 0,
+              kExprReturn,
+            kExprEnd,
+            kExprI32Const, 1,
+          ])
+          .exportFunc();
+    }
+  });
+  const exports = builder.instantiate().exports;
+
+  kComparisons.forEach(([type, opcode, expected], i) => {
+    const values = kValues.get(type);
+    for (const a of values) {
+      for (const b of values) {
+        const result = expected(a, b) ? 1 : 0;
+        assertEquals(result, exports[`cmp${i}_s`](a, b));
+        assertEquals(result, exports[`cmp${i}_r`](a, b));
+      }
+    }
+  });
+})();
+
+(function testCompareBrIfLoop() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  // Sums 0..n-1 with a loop that branches back on `i < n`.
+  builder.addFunction('sum', kSig_i_i)
+      .addLocals(kWasmI32, 2)
+      .addBody([
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 2, kExprLocalGet, 1, kExprI32Add, kExprLocalSet, 2,
+          kExprLocalGet, 1, kExprI32Const, 1, kExprI32Add, kExprLocalTee, 1,
+          kExprLocalGet, 0, kExprI32LtS,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 2,
+      ])
+      .exportFunc();
+  const sum = builder.instantiate().exports.sum;
+  assertEquals(0, sum(0));
+  assertEquals(0, sum(1));
+  assertEquals(45, sum(10));
+  assertEquals(4950, sum(100));
+})();
@@ -9,6 +9,7 @@
 #include "include/v8-template.h"
 #include "src/base/platform/semaphore.h"
 #include "src/init/v8.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -165,4 +166,43 @@ TEST_F(IsolateTest, SetAddCrashKeyCallback) {
   EXPECT_EQ(crash_keys.size(), expected_keys_count);
 }
 
+namespace {
+
+int tiering_policy_calls = 0;
+
+TieringDecision DelayAllOptimizations(Isolate* isolate,
+                                      const TieringCandidate& candidate) {
+  ++tiering_policy_calls;
+  EXPECT_GT(candidate.bytecode_size, 0);
+  EXPECT_GT(candidate.invocation_count, 0);
+  EXPECT_GE(candidate.worker_thread_count, 1);
+  return TieringDecision::kDelay;
+}
+
+}  // namespace
+
+using TieringPolicyTest = TestWithContext;
+
+TEST_F(TieringPolicyTest, CallbackCanDelayOptimization) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate());
+  if (!i_isolate->use_optimizer()) return;
+  i::FlagScope<int> maglev_count(&i::v8_flags.invocation_count_for_maglev, 1);
+  i::FlagScope<int> turbofan_count(&i::v8_flags.invocation_count_for_turbofan,
+                                   1);
+
+  tiering_policy_calls = 0;
+  isolate()->SetTieringPolicyCallback(DelayAllOptimizations);
+  RunJS(
+      "function add(a, b) { return a + b; }"
+      "for (let i = 0; i < 100000; ++i) add(i, 1);");
+  EXPECT_GT(tiering_policy_calls, 0);
+
+  // Delayed functions are asked about again instead of being optimized.
+  int calls = tiering_policy_calls;
+  RunJS("for (let i = 0; i < 100000; ++i) add(i, 1);");
+  EXPECT_GT(tiering_policy_calls, calls);
+
+  isolate()->SetTieringPolicyCallback(nullptr);
+}
+
 }  // namespace v8
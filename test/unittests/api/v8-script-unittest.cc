@@ -11,9 +11,11 @@
 #include "include/v8-local-handle.h"
 #include "include/v8-primitive.h"
 #include "include/v8-template.h"
+#include "src/compiler-dispatcher/lazy-compile-dispatcher.h"
 #include "src/objects/objects-inl.h"
 #include "test/common/flag-utils.h"
 #include "test/common/streaming-helper.h"
+#include "test/unittests/test-helpers.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -554,6 +556,60 @@ TEST_F(CompileHintsTest, CompileHintsMagicCommentBasic) {
   EXPECT_TRUE(FunctionIsCompiled("f2"));
 }
 
+class ParallelCompileHintsTest : public CompileHintsTest {
+ public:
+  static void SetUpTestSuite() {
+    i::v8_flags.parallel_compile_tasks_for_compile_hints = true;
+    i::v8_flags.lazy_compile_dispatcher = true;
+    CompileHintsTest::SetUpTestSuite();
+  }
+
+  static void TearDownTestSuite() {
+    CompileHintsTest::TearDownTestSuite();
+    i::v8_flags.parallel_compile_tasks_for_compile_hints = false;
+    i::v8_flags.lazy_compile_dispatcher = false;
+  }
+};
+
+TEST_F(ParallelCompileHintsTest, CompileHintsMagicCommentParallelCompile) {
+  const char* url = "http://www.foo.com/foo.js";
+  v8::ScriptOrigin origin(NewString(url), 13, 0);
+
+  const char* code =
+      "//# allFunctionsCalledOnLoad\n"
+      "function f1() { return 1; }\n"
+      "let f2 = function() { return 2; }";
+  // Parallel compile tasks need a source that the workers can read without
+  // accessing the heap.
+  Local<String> source =
+      v8::String::NewExternalOneByte(
+          isolate(), new i::test::ScriptResource(code, strlen(code), 0))
+          .ToLocalChecked();
+  v8::ScriptCompiler::Source script_source(source, origin);
+  Local<Script> script =
+      v8::ScriptCompiler::Compile(
+          v8_context(), &script_source,
+          v8::ScriptCompiler::CompileOptions::kFollowCompileHintsMagicComment)
+          .ToLocalChecked();
+  EXPECT_FALSE(script->Run(v8_context()).IsEmpty());
+
+  i::LazyCompileDispatcher* dispatcher = i_isolate()->lazy_compile_dispatcher();
+  ASSERT_NE(nullptr, dispatcher);
+  for (const char* name : {"f1", "f2"}) {
+    auto function = i::Cast<i::JSFunction>(Utils::OpenHandle(*RunJS(name)));
+    i::DirectHandle<i::SharedFunctionInfo> shared(function->shared(),
+                                                  i_isolate());
+    // The hinted functions were handed to the dispatcher instead of being
+    // compiled inline with the top-level code.
+    ASSERT_TRUE(dispatcher->IsEnqueued(shared));
+    EXPECT_FALSE(shared->is_compiled());
+    EXPECT_TRUE(dispatcher->FinishNow(shared));
+    EXPECT_FALSE(dispatcher->IsEnqueued(shared));
+    EXPECT_TRUE(shared->is_compiled());
+  }
+  EXPECT_EQ(3, RunJS("f1() + f2()")->Int32Value(v8_context()).FromJust());
+}
+
 TEST_F(CompileHintsTest, CompileHintsMagicCommentDifferentFunctionTypes) {
   const char* url = "http://www.foo.com/foo.js";
   v8::ScriptOrigin origin(NewString(url), 13, 0);
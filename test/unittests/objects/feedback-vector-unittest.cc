@@ -435,6 +435,53 @@ TEST_F(FeedbackVectorTest, VectorCallSpeculationModeAndFeedbackContent) {
   CHECK_EQ(CallFeedbackContent::kReceiver, nexus.GetCallFeedbackContent());
 }
 
+TEST_F(FeedbackVectorTest, GeneralizeNumberFeedback) {
+  if (!i::v8_flags.use_ic) return;
+  v8_flags.allow_natives_syntax = true;
+
+  v8::HandleScope scope(v8_isolate());
+  Isolate* isolate = i_isolate();
+
+  TryRunJS(
+      "function add(a, b) { return a + b; }"
+      "function less(a, b) { return a < b; }"
+      "%EnsureFeedbackVectorForFunction(add);"
+      "%EnsureFeedbackVectorForFunction(less);"
+      "add(1, 2); less(1, 2);");
+
+  // Each step widens the feedback along SignedSmall < Number <
+  // NumberOrOddball < Any, until it can't be widened any further.
+  FeedbackNexus add_nexus(
+      isolate, handle(GetFunction("add")->feedback_vector(), isolate),
+      FeedbackSlot(0));
+  CHECK_EQ(FeedbackSlotKind::kBinaryOp, add_nexus.kind());
+  CHECK_EQ(BinaryOperationFeedback::kSignedSmall,
+           add_nexus.GetFeedback().ToSmi().value());
+  for (int expected : {BinaryOperationFeedback::kNumber,
+                       BinaryOperationFeedback::kNumberOrOddball,
+                       BinaryOperationFeedback::kAny}) {
+    CHECK(add_nexus.Generalize());
+    CHECK_EQ(expected, add_nexus.GetFeedback().ToSmi().value());
+  }
+  CHECK(!add_nexus.Generalize());
+  CHECK_EQ(BinaryOperationFeedback::kAny,
+           add_nexus.GetFeedback().ToSmi().value());
+
+  FeedbackNexus less_nexus(
+      isolate, handle(GetFunction("less")->feedback_vector(), isolate),
+      FeedbackSlot(0));
+  CHECK_EQ(FeedbackSlotKind::kCompareOp, less_nexus.kind());
+  CHECK_EQ(CompareOperationFeedback::kSignedSmall,
+           less_nexus.GetFeedback().ToSmi().value());
+  for (int expected : {CompareOperationFeedback::kNumber,
+                       CompareOperationFeedback::kNumberOrOddball,
+                       CompareOperationFeedback::kAny}) {
+    CHECK(less_nexus.Generalize());
+    CHECK_EQ(expected, less_nexus.GetFeedback().ToSmi().value());
+  }
+  CHECK(!less_nexus.Generalize());
+}
+
 TEST_F(FeedbackVectorTest, VectorLoadICStates) {
   if (!i::v8_flags.use_ic) return;
   if (i::v8_flags.always_turbofan) return;
@@ -132,6 +132,9 @@ class ValueSerializerTest : public TestWithIsolate {
   Maybe<std::vector<uint8_t>> DoEncode(Local<Value> value) {
     Local<Context> context = serialization_context();
     ValueSerializer serializer(isolate(), GetSerializerDelegate());
+    if (target_version_ != 0) {
+      CHECK(serializer.SetTargetVersion(target_version_));
+    }
     BeforeEncode(&serializer);
     serializer.WriteHeader();
     if (!serializer.WriteValue(context, value).FromMaybe(false)) {
@@ -292,6 +295,10 @@ class ValueSerializerTest : public TestWithIsolate {
         .ToLocalChecked();
   }
 
+  // Makes the serializer write the given format version, instead of the
+  // default one.
+  void set_target_version(uint32_t version) { target_version_ = version; }
+
   Local<Object> NewDummyUint8Array() {
     const uint8_t data[] = {4, 5, 6};
     Local<ArrayBuffer> ab = ArrayBuffer::New(isolate(), sizeof(data));
@@ -304,6 +311,7 @@ class ValueSerializerTest : public TestWithIsolate {
   Global<Context> deserialization_context_;
   Global<FunctionTemplate> host_object_constructor_template_;
   i::Isolate* isolate_;
+  uint32_t target_version_ = 0;
 };
 
 TEST_F(ValueSerializerTest, DecodeInvalid) {
@@ -1383,6 +1391,166 @@ TEST_F(ValueSerializerTest, DecodeDenseArrayContainingUndefined) {
       [this](Local<Value> value) { ExpectScriptTrue("!(0 in result)"); });
 }
 
+TEST_F(ValueSerializerTest, TargetVersion) {
+  // Version 15 is written by default, without the encodings of version 16.
+  EXPECT_EQ(std::vector<uint8_t>({0xFF, 0x0F, 0x41, 0x02, 0x49, 0x02, 0x49,
+                                  0x04, 0x24, 0x00, 0x02}),
+            EncodeTest("[1, 2]"));
+  EXPECT_EQ(std::vector<uint8_t>(
+                {0xFF, 0x0F, 0x6F, 0x22, 0x01, 0x61, 0x49, 0x02, 0x7B, 0x01}),
+            EncodeTest("({a: 1})"));
+
+  set_target_version(16);
+#if defined(V8_TARGET_LITTLE_ENDIAN)
+  EXPECT_EQ(std::vector<uint8_t>({0xFF, 0x10, 0x4A, 0x02, 0x01, 0x00, 0x00,
+                                  0x00, 0x02, 0x00, 0x00, 0x00, 0x24, 0x00,
+                                  0x02}),
+            EncodeTest("[1, 2]"));
+#endif  // V8_TARGET_LITTLE_ENDIAN
+  EXPECT_EQ(std::vector<uint8_t>(
+                {0xFF, 0x10, 0x68, 0x00, 0x01, 0x22, 0x01, 0x61, 0x49, 0x02}),
+            EncodeTest("({a: 1})"));
+
+  // Older versions and versions from the future can't be written.
+  ValueSerializer serializer(isolate());
+  EXPECT_FALSE(serializer.SetTargetVersion(14));
+  EXPECT_FALSE(serializer.SetTargetVersion(
+      v8::CurrentValueSerializerFormatVersion() + 1));
+  EXPECT_TRUE(serializer.SetTargetVersion(15));
+}
+
+TEST_F(ValueSerializerTest, RoundTripDenseNumberArray) {
+  set_target_version(16);
+  Local<Value> value = RoundTripTest("[1, -2, 3]");
+  ASSERT_TRUE(value->IsArray());
+  EXPECT_EQ(3u, Array::Cast(*value)->Length());
+  ExpectScriptTrue("result.toString() === '1,-2,3'");
+
+  value = RoundTripTest("[1.5, NaN, -0, Infinity]");
+  ASSERT_TRUE(value->IsArray());
+  EXPECT_EQ(4u, Array::Cast(*value)->Length());
+  ExpectScriptTrue("result[0] === 1.5");
+  ExpectScriptTrue("Number.isNaN(result[1])");
+  ExpectScriptTrue("Object.is(result[2], -0)");
+  ExpectScriptTrue("result[3] === Infinity");
+
+  // Properties are written after the elements.
+  value = RoundTripTest("var x = [0.5, 1]; x.foo = 'bar'; x");
+  ASSERT_TRUE(value->IsArray());
+  ExpectScriptTrue("result.toString() === '0.5,1'");
+  ExpectScriptTrue("result.foo === 'bar'");
+
+  // Duplicate reference.
+  value = RoundTripTest("var y = [1, 2]; [y, y]");
+  ExpectScriptTrue("result[0] === result[1]");
+}
+
+#if defined(V8_TARGET_LITTLE_ENDIAN)
+TEST_F(ValueSerializerTest, DecodeDenseNumberArray) {
+  // The last value doesn't fit in a Smi with pointer compression.
+  DecodeTestFutureVersions(
+      {0xFF, 0x10, 0x4A, 0x03, 0x01, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF,
+       0xFF, 0xFF, 0xFF, 0x7F, 0x24, 0x00, 0x03},
+      [this](Local<Value> value) {
+        ASSERT_TRUE(value->IsArray());
+        ExpectScriptTrue("result.toString() === '1,-2,2147483647'");
+      });
+  // The second value has the bit pattern of the hole, which must be read as
+  // a regular NaN.
+  DecodeTestFutureVersions(
+      {0xFF, 0x10, 0x45, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F,
+       0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0x24, 0x00, 0x02},
+      [this](Local<Value> value) {
+        ASSERT_TRUE(value->IsArray());
+        ExpectScriptTrue("result.length === 2");
+        ExpectScriptTrue("result[0] === 1.5");
+        ExpectScriptTrue("1 in result && Number.isNaN(result[1])");
+      });
+}
+
+TEST_F(ValueSerializerTest, DecodeInvalidDenseNumberArray) {
+  // The tags don't exist before version 16.
+  InvalidDecodeTest(
+      {0xFF, 0x0F, 0x4A, 0x01, 0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x01});
+  // Empty arrays use the generic encoding.
+  InvalidDecodeTest({0xFF, 0x10, 0x45, 0x00, 0x24, 0x00, 0x00});
+  // Not enough data left in the buffer.
+  InvalidDecodeTest({0xFF, 0x10, 0x45, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+                     0x00, 0xF8, 0x3F, 0x24, 0x00, 0x02});
+  // Length mismatch.
+  InvalidDecodeTest(
+      {0xFF, 0x10, 0x4A, 0x01, 0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x02});
+}
+#endif  // V8_TARGET_LITTLE_ENDIAN
+
+TEST_F(ValueSerializerTest, RoundTripShapedObjects) {
+  set_target_version(16);
+  Local<Value> value =
+      RoundTripTest("[{a: 1, b: 'x'}, {a: 2, b: 'y'}, {a: 3.5, b: {}}]");
+  ASSERT_TRUE(value->IsArray());
+  ExpectScriptTrue("result[0].a === 1 && result[0].b === 'x'");
+  ExpectScriptTrue("result[1].a === 2 && result[1].b === 'y'");
+  ExpectScriptTrue("result[2].a === 3.5 && typeof result[2].b === 'object'");
+  ExpectScriptTrue(
+      "Object.getOwnPropertyNames(result[2]).toString() === 'a,b'");
+
+  // Self reference.
+  value = RoundTripTest("var y = {a: 1}; y.self = y; y");
+  ExpectScriptTrue("result.self === result && result.a === 1");
+
+  // The keys of a shape are only written once.
+  std::vector<uint8_t> data =
+      EncodeTest("[{foo: 1}, {foo: 2}, {foo: 3}, {foo: 4}]");
+  const uint8_t key[] = {'f', 'o', 'o'};
+  int key_count = 0;
+  auto it = data.begin();
+  while ((it = std::search(it, data.end(), std::begin(key), std::end(key))) !=
+         data.end()) {
+    key_count++;
+    it++;
+  }
+  EXPECT_EQ(1, key_count);
+}
+
+TEST_F(ValueSerializerTest, RoundTripShapedObjectWithDeletingGetter) {
+  set_target_version(16);
+  // Serializing |a| deletes |b|, which is then written as absent.
+  Local<Value> value = RoundTripTest(
+      "var y = {a: {get x() { delete y.b; return 1; }}, b: 2}; y");
+  ASSERT_TRUE(value->IsObject());
+  ExpectScriptTrue("result.a.x === 1");
+  ExpectScriptTrue("!result.hasOwnProperty('b')");
+}
+
+TEST_F(ValueSerializerTest, DecodeShapedObjects) {
+  // The second object refers to the shape of the first, and lacks |b|.
+  DecodeTestFutureVersions(
+      {0xFF, 0x10, 0x41, 0x02, 0x68, 0x00, 0x02, 0x22, 0x01, 0x61,
+       0x22, 0x01, 0x62, 0x49, 0x02, 0x49, 0x04, 0x68, 0x00, 0x49,
+       0x06, 0x2D, 0x24, 0x00, 0x02},
+      [this](Local<Value> value) {
+        ASSERT_TRUE(value->IsArray());
+        ExpectScriptTrue("result[0].a === 1 && result[0].b === 2");
+        ExpectScriptTrue("result[1].a === 3 && !('b' in result[1])");
+      });
+}
+
+TEST_F(ValueSerializerTest, DecodeInvalidShapedObject) {
+  // The tag doesn't exist before version 16.
+  InvalidDecodeTest({0xFF, 0x0F, 0x68, 0x00, 0x01, 0x22, 0x01, 0x61, 0x49,
+                     0x02});
+  // Shapes must be numbered in order.
+  InvalidDecodeTest({0xFF, 0x10, 0x68, 0x01, 0x01, 0x22, 0x01, 0x61, 0x49,
+                     0x02});
+  // A shape has at least one key.
+  InvalidDecodeTest({0xFF, 0x10, 0x68, 0x00, 0x00});
+  // Keys are unique.
+  InvalidDecodeTest({0xFF, 0x10, 0x68, 0x00, 0x02, 0x22, 0x01, 0x61, 0x22,
+                     0x01, 0x61, 0x49, 0x02, 0x49, 0x04});
+  // Keys are strings.
+  InvalidDecodeTest({0xFF, 0x10, 0x68, 0x00, 0x01, 0x49, 0x02, 0x49, 0x02});
+}
+
 TEST_F(ValueSerializerTest, RoundTripDate) {
   Local<Value> value = RoundTripTest("new Date(1e6)");
   ASSERT_TRUE(value->IsDate());
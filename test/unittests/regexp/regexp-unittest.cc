@@ -19,6 +19,7 @@
 #include "src/init/v8.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/objects/objects-inl.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "src/regexp/regexp-bytecode-generator.h"
 #include "src/regexp/regexp-bytecodes.h"
 #include "src/regexp/regexp-compiler.h"
@@ -609,6 +610,51 @@ TEST_F(RegExpTest, ParsePossessiveRepetition) {
 
 #endif
 
+TEST_F(RegExpTest, SharedBytecodeCache) {
+  v8::HandleScope scope(v8::Isolate::GetCurrent());
+  Factory* factory = i_isolate()->factory();
+  DirectHandle<String> a = factory->NewStringFromAsciiChecked("a+b");
+  DirectHandle<String> b = factory->NewStringFromAsciiChecked("(c|d)*");
+  DirectHandle<String> c = factory->NewStringFromAsciiChecked("e?f");
+  const uint8_t bytecode[32] = {1, 2, 3};
+  auto NewEntry = [&](size_t size) {
+    return std::make_shared<RegExpBytecodeCache::Entry>(
+        base::VectorOf(bytecode, size), 3, JSRegExp::kNoBacktrackLimit);
+  };
+  const uint32_t kNoLimit = JSRegExp::kNoBacktrackLimit;
+
+  RegExpBytecodeCache cache(64);
+  cache.Insert(*a, {}, true, kNoLimit, NewEntry(32));
+  std::shared_ptr<const RegExpBytecodeCache::Entry> entry =
+      cache.Lookup(*a, {}, true, kNoLimit);
+  ASSERT_NE(entry, nullptr);
+  CHECK_EQ(32, entry->bytecode.size());
+  CHECK_EQ(1, entry->bytecode[0]);
+  CHECK_EQ(3, entry->register_count);
+
+  // Flags, the string representation and the backtrack limit are part of the
+  // key.
+  CHECK_NULL(cache.Lookup(*a, RegExpFlag::kGlobal, true, kNoLimit));
+  CHECK_NULL(cache.Lookup(*a, {}, false, kNoLimit));
+  CHECK_NULL(cache.Lookup(*a, {}, true, 100));
+  CHECK_NULL(cache.Lookup(*b, {}, true, kNoLimit));
+
+  // The least recently used entry is evicted first.
+  cache.Insert(*b, {}, true, kNoLimit, NewEntry(16));
+  CHECK_NOT_NULL(cache.Lookup(*a, {}, true, kNoLimit));
+  cache.Insert(*c, {}, true, kNoLimit, NewEntry(32));
+  CHECK_EQ(64, cache.size_for_testing());
+  CHECK_NOT_NULL(cache.Lookup(*a, {}, true, kNoLimit));
+  CHECK_NULL(cache.Lookup(*b, {}, true, kNoLimit));
+  CHECK_NOT_NULL(cache.Lookup(*c, {}, true, kNoLimit));
+
+  // Evicted entries stay alive while they are referenced.
+  cache.Clear();
+  CHECK_EQ(0, cache.size_for_testing());
+  CHECK_NULL(cache.Lookup(*a, {}, true, kNoLimit));
+  CHECK_EQ(3, entry->bytecode[2]);
+}
+
 // Tests of interpreter.
 
 #if V8_TARGET_ARCH_IA32
@@ -6,11 +6,15 @@
 
 #include "src/objects/objects-inl.h"
 
+#include "src/base/platform/platform.h"
+#include "src/base/platform/wrappers.h"
 #include "src/wasm/module-decoder.h"
 #include "src/wasm/streaming-decoder.h"
+#include "src/wasm/wasm-serialization.h"
 
 #include "src/objects/descriptor-array.h"
 #include "src/objects/dictionary.h"
+#include "test/common/flag-utils.h"
 #include "test/common/wasm/wasm-macro-gen.h"
 
 namespace v8 {
@@ -93,6 +97,11 @@ class MockStreamingProcessor : public StreamingProcessor {
     return false;
   }
 
+  bool DeserializeFromFileCache(
+      base::Vector<const uint8_t> wire_bytes) override {
+    return false;
+  }
+
  private:
   MockStreamingResult* const result_;
 };
@@ -659,6 +668,60 @@ TEST_F(WasmStreamingDecoderTest, InvalidSectionCode) {
   ExpectFailure(base::ArrayVector(data));
 }
 
+TEST_F(WasmStreamingDecoderTest, FileCacheBuffersOnlyOnPrefixMatch) {
+  const uint8_t data[] = {
+      U32_LE(kWasmMagic),    // --
+      U32_LE(kWasmVersion),  // --
+      0x1,                   // Section ID
+      0x1,                   // Section Length
+      0x0,                   // Payload
+      kCodeSectionCode,      // Section ID
+      0x5,                   // Section Length
+      0x2,                   // Number of Functions
+      0x1,                   // Function Length
+      0x0,                   // Function
+      0x1,                   // Function Length
+      0x0,                   // Function
+  };
+  base::Vector<const uint8_t> bytes = base::ArrayVector(data);
+  FlagScope<const char*> file_cache(&v8_flags.wasm_native_module_file_cache,
+                                    ".");
+  std::string prefix_path = GetNativeModuleFileCachePrefixPath(bytes);
+  base::OS::Remove(prefix_path.c_str());
+
+  // Without a stored module with the same prefix, functions are streamed.
+  {
+    MockStreamingResult result;
+    auto stream = StreamingDecoder::CreateAsyncStreamingDecoder(
+        std::make_unique<MockStreamingProcessor>(&result));
+    stream->OnBytesReceived(bytes);
+    EXPECT_EQ(2u, result.num_functions);
+    stream->Finish();
+    EXPECT_TRUE(result.ok());
+  }
+
+  // With a matching prefix, the code section is buffered until {Finish}. On a
+  // cache miss it is decoded from there, without processing sections twice.
+  FILE* marker = base::OS::FOpen(prefix_path.c_str(), "wb");
+  ASSERT_NE(nullptr, marker);
+  base::Fclose(marker);
+  for (size_t split = 0; split <= bytes.size(); ++split) {
+    MockStreamingResult result;
+    auto stream = StreamingDecoder::CreateAsyncStreamingDecoder(
+        std::make_unique<MockStreamingProcessor>(&result));
+    stream->OnBytesReceived(bytes.SubVector(0, split));
+    stream->OnBytesReceived(bytes.SubVector(split, bytes.size()));
+    EXPECT_EQ(1u, result.num_sections);
+    EXPECT_EQ(0u, result.num_functions);
+    stream->Finish();
+    EXPECT_TRUE(result.ok());
+    EXPECT_EQ(1u, result.num_sections);
+    EXPECT_EQ(2u, result.num_functions);
+    EXPECT_EQ(bytes, result.received_bytes.as_vector());
+  }
+  base::OS::Remove(prefix_path.c_str());
+}
+
 }  // namespace wasm
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,99 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <vector>
+
+#include "test/wasm-api-tests/wasm-api-test.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+
+namespace {
+
+void MakeArgs(size_t count, std::vector<vec<Val>>* args,
+              std::vector<vec<Val>>* results) {
+  for (size_t i = 0; i < count; ++i) {
+    args->push_back(vec<Val>::make(Val::i32(static_cast<int32_t>(i) + 1)));
+    results->push_back(vec<Val>::make_uninitialized(1));
+  }
+}
+
+own<Trap> PlusOne(const vec<Val>& args, vec<Val>& results) {
+  results[0] = Val::i32(args[0].i32() + 1);
+  return nullptr;
+}
+
+}  // namespace
+
+TEST_F(WasmCapiTest, BatchCalls) {
+  // Divides 100 by its argument, which traps for 0.
+  uint8_t code[] = {WASM_I32_DIVS(WASM_I32V_1(100), WASM_LOCAL_GET(0))};
+  AddExportedFunction(base::CStrVector("div"), code, sizeof(code),
+                      wasm_i_i_sig());
+  vec<Extern*> imports = vec<Extern*>::make();
+  Instantiate(imports);
+  Func* div = GetExportedFunction(0);
+
+  constexpr size_t kNumCalls = 5;
+  std::vector<vec<Val>> args;
+  std::vector<vec<Val>> results;
+  MakeArgs(kNumCalls, &args, &results);
+  EXPECT_EQ(nullptr, div->call_batch(kNumCalls, args.data(), results.data()));
+  EXPECT_EQ(100, results[0][0].i32());
+  EXPECT_EQ(50, results[1][0].i32());
+  EXPECT_EQ(33, results[2][0].i32());
+  EXPECT_EQ(25, results[3][0].i32());
+  EXPECT_EQ(20, results[4][0].i32());
+
+  // The batch stops at the first trap.
+  args[2][0] = Val::i32(0);
+  results[3][0] = Val::i32(-1);
+  own<Trap> trap = div->call_batch(kNumCalls, args.data(), results.data());
+  EXPECT_NE(nullptr, trap);
+  EXPECT_EQ(50, results[1][0].i32());
+  EXPECT_EQ(-1, results[3][0].i32());
+}
+
+TEST_F(WasmCapiTest, BatchCallsCapiFunction) {
+  own<Func> plus_one = Func::make(store(), cpp_i_i_sig(), PlusOne);
+  constexpr size_t kNumCalls = 3;
+  std::vector<vec<Val>> args;
+  std::vector<vec<Val>> results;
+  MakeArgs(kNumCalls, &args, &results);
+  EXPECT_EQ(nullptr,
+            plus_one->call_batch(kNumCalls, args.data(), results.data()));
+  for (size_t i = 0; i < kNumCalls; ++i) {
+    EXPECT_EQ(static_cast<int32_t>(i) + 2, results[i][0].i32());
+  }
+}
+
+// Batched calls give the same results as single calls.
+TEST_F(WasmCapiTest, BatchCallsMatchSingleCalls) {
+  uint8_t code[] = {WASM_I32_ADD(WASM_LOCAL_GET(0), WASM_ONE)};
+  AddExportedFunction(base::CStrVector("inc"), code, sizeof(code),
+                      wasm_i_i_sig());
+  vec<Extern*> imports = vec<Extern*>::make();
+  Instantiate(imports);
+  Func* inc = GetExportedFunction(0);
+
+  constexpr size_t kNumCalls = 100;
+  std::vector<vec<Val>> args;
+  std::vector<vec<Val>> single_results;
+  std::vector<vec<Val>> batch_results;
+  MakeArgs(kNumCalls, &args, &single_results);
+  for (size_t i = 0; i < kNumCalls; ++i) {
+    batch_results.push_back(vec<Val>::make_uninitialized(1));
+    EXPECT_EQ(nullptr, inc->call(args[i], single_results[i]));
+  }
+  EXPECT_EQ(nullptr,
+            inc->call_batch(kNumCalls, args.data(), batch_results.data()));
+  for (size_t i = 0; i < kNumCalls; ++i) {
+    EXPECT_EQ(single_results[i][0].i32(), batch_results[i][0].i32());
+  }
+}
+
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
@@ -430,6 +430,11 @@ WASM_API_EXTERN size_t wasm_func_result_arity(const wasm_func_t*);
 
 WASM_API_EXTERN own wasm_trap_t* wasm_func_call(
   const wasm_func_t*, const wasm_val_vec_t* args, wasm_val_vec_t* results);
+// V8 extension: performs `count` calls with a single entry into the engine.
+// Stops at the first call that traps and returns its trap.
+WASM_API_EXTERN own wasm_trap_t* wasm_func_call_batch(
+  const wasm_func_t*, size_t count, const wasm_val_vec_t args[],
+  wasm_val_vec_t results[]);
 
 
 // Global Instances
@@ -743,6 +743,10 @@ public:
   auto result_arity() const -> size_t;
 
   auto call(const vec<Val>&, vec<Val>&) const -> own<Trap>;
+  // V8 extension: performs `count` calls with a single entry into the engine.
+  // Stops at the first call that traps and returns its trap.
+  auto call_batch(size_t count, const vec<Val> args[], vec<Val> results[]) const
+    -> own<Trap>;
 };
 
 